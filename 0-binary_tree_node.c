@@ -15,6 +15,7 @@ binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 
 	if (!new_node)
 		return (NULL);
+	BT_COUNT(allocs);
 
 	new_node->n = value;
 	new_node->left = NULL;
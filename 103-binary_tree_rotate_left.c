@@ -13,6 +13,7 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 
 	if (tree && tree->right)
 	{
+		BT_COUNT(rotations);
 		tree = tree->right;  /* Swap root with root->right */
 		old_tree->right = tree->left;
 		if (tree->left)
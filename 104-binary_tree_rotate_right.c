@@ -13,6 +13,7 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
 
 	if (tree && tree->left)
 	{
+		BT_COUNT(rotations);
 		tree = tree->left;
 		old_tree->left = tree->right;
 		if (tree->right)
@@ -13,13 +13,21 @@ bst_t *insert_value(bst_t *tree, int value);
 */
 bst_t *bst_insert(bst_t **tree, int value)
 {
+	bst_t *new_node;
+
+	BT_OP_ENTER(BT_OP_BST_INSERT);
 	if (!*tree)
 	{
 		*tree = binary_tree_node(NULL, value);
-		return (*tree);
+		new_node = *tree;
+	}
+	else
+	{
+		new_node = insert_value(*tree, value);
 	}
+	BT_OP_EXIT();
 
-	return (insert_value(*tree, value));
+	return (new_node);
 }
 
 /**
@@ -35,8 +43,8 @@ bst_t *insert_value(bst_t *tree, int value)
 {
 	bst_t *new_node;
 
-	if ((!tree->left && value < tree->n) ||
-	(!tree->right && value > tree->n))
+	if ((!tree->left && BT_CMP(value < tree->n)) ||
+	(!tree->right && BT_CMP(value > tree->n)))
 	{
 
 		new_node = binary_tree_node(tree, value);
@@ -52,11 +60,11 @@ bst_t *insert_value(bst_t *tree, int value)
 	}
 	else
 	{
-		if (value == tree->n)
+		if (BT_CMP(value == tree->n))
 			return (NULL);
-		else if (value < tree->n)
-			return (insert_value(tree->left, value));
+		else if (BT_CMP(value < tree->n))
+			return (insert_value(BT_HOP(tree->left), value));
 		else
-			return (insert_value(tree->right, value));
+			return (insert_value(BT_HOP(tree->right), value));
 	}
 }
@@ -11,17 +11,15 @@
 */
 bst_t *bst_search(const bst_t *tree, int value)
 {
-	if (!tree)
+	BT_OP_ENTER(BT_OP_BST_SEARCH);
+	while (tree && BT_CMP(tree->n != value))
 	{
-		return (NULL);
-	}
-	else
-	{
-		if (tree->n == value)
-			return ((bst_t *)tree);
-		else if (tree->n > value)
-			return (bst_search(tree->left, value));
+		if (BT_CMP(tree->n > value))
+			tree = BT_HOP(tree->left);
 		else
-			return (bst_search(tree->right, value));
+			tree = BT_HOP(tree->right);
 	}
+	BT_OP_EXIT();
+
+	return ((bst_t *)tree);
 }
@@ -2,10 +2,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 
-bst_t *search(bst_t *root, int value);
-bst_t *get_swap_node(const bst_t *node, int val);
-void swap_values_if_not_parent(bst_t *swap_node, bst_t *node_to_remove);
-void swap_values_if_parent(bst_t *swap_node, bst_t *node_to_remove);
+bst_t *bst_unlink(bst_t *root, bst_t *node);
+bst_t *bst_remove_finger(bst_t *finger, int value);
 
 /**
  * bst_remove - Removes a node from the BST.
@@ -19,139 +17,138 @@ void swap_values_if_parent(bst_t *swap_node, bst_t *node_to_remove);
 */
 bst_t *bst_remove(bst_t *root, int value)
 {
-	bst_t *node_to_remove, *swap_node;
+	bst_t *node = root;
 
-	node_to_remove = search(root, value);
-	if (!node_to_remove)
-		return (root);
-
-	swap_node = (node_to_remove->right && node_to_remove->left) ?
-		get_swap_node(node_to_remove->right, node_to_remove->n) :
-		get_swap_node(node_to_remove, node_to_remove->n);
-
-	if (swap_node != node_to_remove)
-	{
-		if (swap_node->parent != node_to_remove)
-			swap_values_if_not_parent(swap_node, node_to_remove);
-		else
-			swap_values_if_parent(swap_node, node_to_remove);
-
-		if (node_to_remove->parent)
-		{
-			if (node_to_remove == node_to_remove->parent->left)
-				node_to_remove->parent->left = swap_node;
-			else
-				node_to_remove->parent->right = swap_node;
-		}
-		swap_node->parent = node_to_remove->parent;
-	}
-	else
+	BT_OP_ENTER(BT_OP_BST_REMOVE);
+	while (node && !BT_CMP(node->n == value))
+		node = BT_CMP(value < node->n) ?
+			BT_HOP(node->left) : BT_HOP(node->right);
+	if (node)
 	{
-		if (swap_node == swap_node->parent->left)
-			swap_node->parent->left = NULL;
-		else
-			swap_node->parent->right = NULL;
+		root = bst_unlink(root, node);
+		free(node);
+		BT_COUNT(frees);
 	}
-	free(node_to_remove);
-	if (swap_node && !swap_node->parent)
-		return (swap_node);
-	else
-		return (root);
+	BT_OP_EXIT();
+
+	return (root);
 }
 
 /**
- * search - Finds the node to remove.
+ * bst_unlink - Takes a node out of a BST without freeing it.
  *
- * @root: Pointer to the root of the BST.
- * @value: value of the node to find.
+ * Description: A node with two children is replaced by its successor, the
+ *	lowest node of its right subtree, which is first moved out of its own
+ *	place, its right child taking it. Nothing but pointers is moved, so
+ *	pointers to the other nodes stay valid.
  *
- * Return: Pointer to the node with the given value.
+ * @root: Pointer to the root node of the BST.
+ * @node: Pointer to the node to take out.
+ *
+ * Return: Pointer to the root node of the resulting tree.
 */
-bst_t *search(bst_t *root, int value)
+bst_t *bst_unlink(bst_t *root, bst_t *node)
 {
-	if (!root)
+	bst_t *next = node->left ? node->left : node->right;
+
+	if (node->left && node->right)
 	{
-		return (NULL);
+		next = BT_HOP(node->right);
+		while (next->left)
+			next = BT_HOP(next->left);
+		if (next != node->right)
+		{
+			next->parent->left = next->right;
+			if (next->right)
+				next->right->parent = next->parent;
+			next->right = node->right;
+			node->right->parent = next;
+		}
+		next->left = node->left;
+		node->left->parent = next;
 	}
+
+	if (next)
+		next->parent = node->parent;
+	if (!node->parent)
+		root = next;
+	else if (node->parent->left == node)
+		node->parent->left = next;
 	else
-	{
-		if (root->n == value)
-			return (root);
-		else if (root->n > value)
-			return (search(root->left, value));
-		else
-			return (search(root->right, value));
-	}
+		node->parent->right = next;
+
+	return (root);
 }
 
 /**
- * get_swap_node - Get the node to take place of the one being deleted.
+ * bst_remove_sorted - Removes a batch of values from a BST.
  *
- * @node: Pointer to the node to remove if it has one child. Should be
- *	given as pointer to the right child of the node to remove if it
- *	has both children.
- * @val: Value of the node to remove.
+ * Description: The search for each value starts from the last node the
+ *	previous one turned right at, going up only as far as the lowest
+ *	ancestor that may hold the value, so a sorted batch is removed in a
+ *	single left to right walk over the tree rather than one walk from the
+ *	root per value. A value lower than the one before starts from the
+ *	root again, so the batch does not have to be sorted.
  *
- * Return: Pointer to the node to swap with the one to remove.
-*/
-bst_t *get_swap_node(const bst_t *node, int val)
-{
-	if (!node->right && !node->left)
-		return ((bst_t *)node);
-
-	if (node->right && node->left && node->right->left &&
-	(node->left->n - val) > (node->right->left->n - val))
-		return (get_swap_node(node->right->left, val));
-	else if (node->left)
-		return (get_swap_node(node->left, val));
-	else if (node->right)
-		return (node->right);
-
-	return ((bst_t *)node);
-}
-
-/**
- * swap_values_if_not_parent - Gives the swap node its new pointer values if
- *	node to be deleted is not parent of the swap node.
+ * @root: Pointer to the root node of the BST.
+ * @values: Array of values to remove.
+ * @size: Number of values in the array.
  *
- * @swap_node: Pointer to occupy place of the deleted node.
- * @node_to_remove: Pointer to the node to be deleted.
+ * Return: Pointer to the root node of the resulting tree.
 */
-void swap_values_if_not_parent(bst_t *swap_node, bst_t *node_to_remove)
+bst_t *bst_remove_sorted(bst_t *root, const int *values, size_t size)
 {
-	if (swap_node->parent->left == swap_node)
-		swap_node->parent->left = NULL;
-	else
-		swap_node->parent->right = NULL;
+	bst_t *finger = NULL, *node;
+	size_t i;
 
-	swap_node->left = node_to_remove->left;
-	swap_node->right = node_to_remove->right;
+	BT_OP_ENTER(BT_OP_BST_REMOVE);
+	for (i = 0; values && root && i < size; i++)
+	{
+		if (i && values[i] < values[i - 1])
+			finger = NULL;
+		node = finger ? bst_remove_finger(finger, values[i]) : root;
+		finger = NULL;
+		while (node && !BT_CMP(node->n == values[i]))
+		{
+			if (BT_CMP(values[i] < node->n))
+				node = BT_HOP(node->left);
+			else
+			{
+				finger = node;
+				node = BT_HOP(node->right);
+			}
+		}
+		if (node)
+		{
+			root = bst_unlink(root, node);
+			free(node);
+			BT_COUNT(frees);
+		}
+	}
+	BT_OP_EXIT();
 
-	if (node_to_remove->left)
-		node_to_remove->left->parent = swap_node;
-	if (node_to_remove->right)
-		node_to_remove->right->parent = swap_node;
+	return (root);
 }
 
 /**
- * swap_values_if_parent - Gives the swap node its new pointer values if node
- *	to be deleted is the parent of the swap node.
+ * bst_remove_finger - Finds the lowest ancestor of a node whose subtree
+ *	may hold a value greater than the node.
  *
- * @swap_node: Pointer to occupy place of the deleted node.
- * @node_to_remove: Pointer to the node to be deleted.
+ * Description: Going up from a left child to a parent greater than value
+ *	means value is between the node and its parent, so within the
+ *	subtree of the node. Any other parent is lower than value, which
+ *	keeps it the same on the way up.
+ *
+ * @finger: Pointer to the node to start from, lower than value.
+ * @value: Value to find the subtree of.
+ *
+ * Return: Pointer to the root of the subtree to search value in.
 */
-void swap_values_if_parent(bst_t *swap_node, bst_t *node_to_remove)
+bst_t *bst_remove_finger(bst_t *finger, int value)
 {
-	if (swap_node == node_to_remove->left)
-	{
-		swap_node->right = node_to_remove->right;
-		if (node_to_remove->right)
-			node_to_remove->right->parent = swap_node;
-	}
-	else
-	{
-		swap_node->left = node_to_remove->left;
-		if (node_to_remove->left)
-			node_to_remove->left->parent = swap_node;
-	}
+	while (finger->parent && (finger != finger->parent->left ||
+		!BT_CMP(value < finger->parent->n)))
+		finger = BT_HOP(finger->parent);
+
+	return (finger);
 }
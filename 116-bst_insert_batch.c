@@ -0,0 +1,195 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+bst_t *bst_batch_slot(bst_t *root, bst_t *finger, int value,
+	bst_t **upper);
+bst_t *bst_batch_build(const int *values, size_t lo, size_t hi,
+	bst_t *parent);
+int bst_batch_compare(const void *a, const void *b);
+size_t bst_batch_merge(bst_t **tree, const int *values, size_t size,
+	void (*fix)(bst_t **, bst_t *));
+
+/**
+ * bst_insert_batch - Inserts a batch of values in a BST.
+ *
+ * @tree: Double pointer to the root node of the BST.
+ * @values: Array of values to insert, in any order.
+ * @size: Number of values in the array.
+ *
+ * Return: Number of values inserted, values already in the tree or given
+ *	twice being skipped, and the insertion stopping on failure.
+*/
+size_t bst_insert_batch(bst_t **tree, const int *values, size_t size)
+{
+	int *sorted;
+	size_t i, count = 0;
+
+	if (!tree || !values || !size)
+		return (0);
+	sorted = malloc(sizeof(*sorted) * size);
+	if (!sorted)
+		return (0);
+	memcpy(sorted, values, sizeof(*values) * size);
+	qsort(sorted, size, sizeof(*sorted), &bst_batch_compare);
+	for (i = 0; i < size; i++)
+		if (!count || sorted[count - 1] != sorted[i])
+			sorted[count++] = sorted[i];
+
+	BT_OP_ENTER(BT_OP_BST_INSERT);
+	count = bst_batch_merge(tree, sorted, count, NULL);
+	BT_OP_EXIT();
+	free(sorted);
+
+	return (count);
+}
+
+/**
+ * bst_batch_merge - Merges sorted values into a BST.
+ *
+ * Description: Each search starts from the greatest value inserted
+ *	before, going up only as far as the lowest ancestor whose subtree may
+ *	hold the next value, so the whole batch is merged in one left to
+ *	right walk over the tree. The values falling between the same two
+ *	values of the tree are linked in at once, as a perfectly balanced
+ *	subtree built as by sorted_array_to_avl.
+ *
+ * @tree: Double pointer to the root node of the BST.
+ * @values: Array of values to insert, increasing, each given once.
+ * @size: Number of values in the array.
+ * @fix: Function to call on each subtree linked in, to restore a balance
+ *	property of the tree, or NULL.
+ *
+ * Return: Number of values inserted, values already in the tree being
+ *	skipped, and the insertion stopping on failure.
+*/
+size_t bst_batch_merge(bst_t **tree, const int *values, size_t size,
+	void (*fix)(bst_t **, bst_t *))
+{
+	bst_t *finger = NULL, *parent, *upper, *run;
+	size_t i, j, count = 0;
+
+	for (i = 0; i < size; i = j)
+	{
+		parent = bst_batch_slot(*tree, finger, values[i], &upper);
+		j = i + 1;
+		if (parent && parent->n == values[i])
+		{
+			finger = parent;
+			continue;
+		}
+		while (j < size && (!upper || BT_CMP(values[j] < upper->n)))
+			j++;
+		run = bst_batch_build(values, i, j, parent);
+		if (!run)
+			break;
+		if (!parent)
+			*tree = run;
+		else if (values[i] < parent->n)
+			parent->left = run;
+		else
+			parent->right = run;
+		count += j - i;
+		for (finger = run; finger->right; finger = finger->right)
+			;
+		if (fix)
+			fix(tree, run);
+	}
+
+	return (count);
+}
+
+/**
+ * bst_batch_slot - Finds where a value goes in a BST.
+ *
+ * Description: Going up from a left child to a parent greater than value
+ *	means value is between the finger and that parent, so within the
+ *	subtree reached. Any other parent is lower than value.
+ *
+ * @root: Pointer to the root node of the BST.
+ * @finger: Pointer to a node lower than value to start from, or NULL to
+ *	start from root.
+ * @value: Value to find the place of.
+ * @upper: Pointer to store the lowest node greater than value in, or NULL
+ *	if there is none.
+ *
+ * Return: Pointer to the node holding value if there is one, otherwise to
+ *	the node value is to be the child of, or NULL if root is NULL.
+*/
+bst_t *bst_batch_slot(bst_t *root, bst_t *finger, int value,
+	bst_t **upper)
+{
+	bst_t *node = finger ? finger : root, *parent = NULL;
+
+	while (finger && node->parent && (node != node->parent->left ||
+		!BT_CMP(value < node->parent->n)))
+		node = BT_HOP(node->parent);
+	*upper = finger ? node->parent : NULL;
+
+	while (node)
+	{
+		parent = node;
+		if (BT_CMP(value == node->n))
+			break;
+		if (BT_CMP(value < node->n))
+		{
+			*upper = node;
+			node = BT_HOP(node->left);
+		}
+		else
+			node = BT_HOP(node->right);
+	}
+
+	return (parent);
+}
+
+/**
+ * bst_batch_build - Builds the perfectly balanced subtree of a range of
+ *	sorted values.
+ *
+ * @values: Array of values.
+ * @lo: Index of the first value of the range.
+ * @hi: Index after the last value of the range.
+ * @parent: Pointer to the parent of the subtree.
+ *
+ * Return: Pointer to the root node of the subtree, or NULL if the range
+ *	is empty or on failure, in which case nothing is left allocated.
+*/
+bst_t *bst_batch_build(const int *values, size_t lo, size_t hi,
+	bst_t *parent)
+{
+	size_t midpoint = (hi + lo) / 2;
+	bst_t *node;
+
+	if (lo >= hi)
+		return (NULL);
+
+	node = binary_tree_node(parent, values[midpoint]);
+	if (!node)
+		return (NULL);
+	node->left = bst_batch_build(values, lo, midpoint, node);
+	node->right = bst_batch_build(values, midpoint + 1, hi, node);
+	if ((lo < midpoint && !node->left) ||
+		(midpoint + 1 < hi && !node->right))
+	{
+		binary_tree_delete(node);
+		return (NULL);
+	}
+
+	return (node);
+}
+
+/**
+ * bst_batch_compare - Compares two values for qsort.
+ *
+ * @a: Pointer to the first value.
+ * @b: Pointer to the second value.
+ *
+ * Return: Negative, 0 or positive as a is lower, equal or greater than b.
+*/
+int bst_batch_compare(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return ((x > y) - (x < y));
+}
@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+size_t bst_rebuild_flatten(bst_t *tree, bst_t **nodes);
+bst_t *bst_rebuild_link(bst_t **nodes, size_t lo, size_t hi, bst_t *parent);
+
+/**
+ * bst_rebuild - Rebuilds a subtree of a BST into a perfectly balanced one.
+ *
+ * Description: The nodes are listed in order, then linked back with the
+ *	midpoint recursion of sorted_array_to_avl, the middle node of each
+ *	range becoming the root of its subtree. No node is allocated or
+ *	freed, so pointers to them stay valid, and it takes O(n) time.
+ *
+ * @tree: Pointer to the root node of the subtree, linked in its parent.
+ * @size: Number of nodes in the subtree, or 0 to have them counted.
+ *
+ * Return: Pointer to the node taking the place of tree, or tree itself if
+ *	memory is short, the subtree being then left as it was.
+*/
+bst_t *bst_rebuild(bst_t *tree, size_t size)
+{
+	bst_t **nodes, *parent, *root;
+
+	if (!tree)
+		return (NULL);
+	if (!size)
+		size = bst_rebuild_flatten(tree, NULL);
+	nodes = malloc(sizeof(*nodes) * size);
+	if (!nodes)
+		return (tree);
+
+	bst_rebuild_flatten(tree, nodes);
+	parent = tree->parent;
+	root = bst_rebuild_link(nodes, 0, size, parent);
+	if (parent && parent->left == tree)
+		parent->left = root;
+	else if (parent)
+		parent->right = root;
+	free(nodes);
+
+	return (root);
+}
+
+/**
+ * bst_rebuild_flatten - Lists the nodes of a subtree in order.
+ *
+ * Description: The walk follows the parent pointers back up instead of
+ *	keeping a stack, and never goes above tree.
+ *
+ * @tree: Pointer to the root node of the subtree.
+ * @nodes: Array to store the nodes in, or NULL to only count them.
+ *
+ * Return: Number of nodes in the subtree.
+*/
+size_t bst_rebuild_flatten(bst_t *tree, bst_t **nodes)
+{
+	bst_t *node = tree;
+	size_t count = 0;
+
+	while (node->left)
+		node = BT_HOP(node->left);
+	while (node)
+	{
+		if (nodes)
+			nodes[count] = node;
+		count++;
+		if (node->right)
+		{
+			node = BT_HOP(node->right);
+			while (node->left)
+				node = BT_HOP(node->left);
+			continue;
+		}
+		while (node != tree && node == node->parent->right)
+			node = BT_HOP(node->parent);
+		node = node == tree ? NULL : BT_HOP(node->parent);
+	}
+
+	return (count);
+}
+
+/**
+ * bst_rebuild_link - Links a range of nodes listed in order into a
+ *	perfectly balanced subtree.
+ *
+ * Description: The lower half of a range is never the smaller one, so the
+ *	leftmost path of the subtree is one of its longest.
+ *
+ * @nodes: Array of the nodes in order.
+ * @lo: Index of the first node of the range.
+ * @hi: Index after the last node of the range.
+ * @parent: Pointer to the parent of the subtree.
+ *
+ * Return: Pointer to the root node of the subtree, or NULL if the range
+ *	is empty.
+*/
+bst_t *bst_rebuild_link(bst_t **nodes, size_t lo, size_t hi, bst_t *parent)
+{
+	size_t midpoint;
+	bst_t *node;
+
+	if (lo >= hi)
+		return (NULL);
+
+	midpoint = (hi + lo) / 2;
+	node = nodes[midpoint];
+	node->parent = parent;
+	node->left = bst_rebuild_link(nodes, lo, midpoint, node);
+	node->right = bst_rebuild_link(nodes, midpoint + 1, hi, node);
+
+	return (node);
+}
@@ -0,0 +1,110 @@
+#include "binary_trees.h"
+
+int bst_hint_inside(const bst_t *hint, int value, int right);
+
+/**
+ * bst_search_hint - Searches for a value in a BST, starting from a node
+ *	close to it.
+ *
+ * @hint: Pointer to any node of the BST, ideally one close to value, such
+ *	as the one returned by the previous search.
+ * @value: Value to search in the tree.
+ *
+ * Return: Pointer to the node containing a value equal to value, or NULL
+ *	if hint is NULL, or if nothing is found.
+*/
+bst_t *bst_search_hint(const bst_t *hint, int value)
+{
+	bst_t *node;
+
+	BT_OP_ENTER(BT_OP_BST_SEARCH);
+	node = bst_hint_slot(hint, value);
+	BT_OP_EXIT();
+
+	return (node && node->n == value ? node : NULL);
+}
+
+/**
+ * bst_hint_slot - Finds where a value is, or goes, in a BST, starting from
+ *	a node close to it.
+ *
+ * Description: For a value greater than hint, the walk goes up from hint
+ *	to the first ancestor greater than value reached from its left child,
+ *	or to the root, then down from the lowest node passed whose subtree
+ *	may hold value, and the other way round for a lower value. In a
+ *	balanced tree, the way down to a value d values away from hint takes
+ *	O(log(d)) steps. The way up does not depend on d: two neighbouring
+ *	values on each side of the root only meet at the root, so the walk is
+ *	in O(log(n)) at worst, as bst_search, and only shorter on average,
+ *	when value shares a low ancestor with hint. The walk up is skipped
+ *	when bst_hint_inside tells value is in the subtree of hint.
+ *
+ * @hint: Pointer to any node of the BST.
+ * @value: Value to find the place of.
+ *
+ * Return: Pointer to the node holding value if there is one, otherwise to
+ *	the node value is to be the child of, or NULL if hint is NULL.
+*/
+bst_t *bst_hint_slot(const bst_t *hint, int value)
+{
+	const bst_t *node, *start = hint, *parent = NULL;
+	int right;
+
+	if (!hint || BT_CMP(hint->n == value))
+		return ((bst_t *)hint);
+	right = BT_CMP(value > hint->n);
+	node = bst_hint_inside(hint, value, right) ? NULL : hint;
+	for (; node && node->parent; node = BT_HOP(node->parent))
+	{
+		if (node == (right ? node->parent->left : node->parent->right))
+		{
+			if (right ? BT_CMP(value < node->parent->n) :
+				BT_CMP(value > node->parent->n))
+				break;
+			start = node->parent;
+		}
+	}
+
+	for (node = start; node && BT_CMP(node->n != value);)
+	{
+		parent = node;
+		if (BT_CMP(value < node->n))
+			node = BT_HOP(node->left);
+		else
+			node = BT_HOP(node->right);
+	}
+
+	return ((bst_t *)(node ? node : parent));
+}
+
+/**
+ * bst_hint_inside - Tells whether a value is known to be in the subtree of
+ *	a node of a BST, on the side it is on.
+ *
+ * Description: For a value greater than hint, the subtree of hint holds
+ *	the values between hint and its lowest ancestor reached from a left
+ *	child. Value is below that far bound if it is not above the right
+ *	child of hint, which is below the bound, or if hint is the left child
+ *	of a parent above value, the parent being the bound. The other way
+ *	round for a lower value.
+ *
+ * @hint: Pointer to the node.
+ * @value: Value, other than the one of hint.
+ * @right: 1 if value is greater than hint, 0 if it is lower.
+ *
+ * Return: 1 if value is in the subtree of hint, 0 if it may not be.
+*/
+int bst_hint_inside(const bst_t *hint, int value, int right)
+{
+	const bst_t *child = right ? hint->right : hint->left;
+	const bst_t *parent = hint->parent;
+
+	if (child && (right ? !BT_CMP(value > child->n) :
+		!BT_CMP(value < child->n)))
+		return (1);
+
+	if (!parent || hint != (right ? parent->left : parent->right))
+		return (0);
+
+	return (right ? BT_CMP(value < parent->n) : BT_CMP(value > parent->n));
+}
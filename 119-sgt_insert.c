@@ -0,0 +1,149 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+void sgt_rebalance(sgt_t *tree, bst_t *node);
+size_t sgt_limit(size_t size);
+size_t bst_rebuild_flatten(bst_t *tree, bst_t **nodes);
+bst_t *bst_unlink(bst_t *root, bst_t *node);
+
+/**
+ * sgt_insert - Inserts a value in a scapegoat tree.
+ *
+ * Description: The value is inserted as by bst_insert, without any
+ *	rotation. Only an insertion deeper than twice the binary logarithm of
+ *	the size of the tree rebuilds a subtree, so a tree mostly searched,
+ *	or filled in bulk, pays almost nothing to stay balanced, and a search
+ *	never goes deeper than that.
+ *
+ * @tree: Pointer to the tree, starting as {NULL, 0, 0}.
+ * @value: Value to store in the inserted node.
+ *
+ * Return: Pointer to the newly created node, or NULL if value already
+ *	exists or if failure occurs.
+*/
+bst_t *sgt_insert(sgt_t *tree, int value)
+{
+	bst_t **link, *parent = NULL, *node = NULL;
+	size_t depth = 0;
+
+	if (!tree)
+		return (NULL);
+
+	BT_OP_ENTER(BT_OP_BST_INSERT);
+	link = &tree->root;
+	while (*link && BT_CMP((*link)->n != value))
+	{
+		parent = BT_HOP(*link);
+		if (BT_CMP(value < parent->n))
+			link = &parent->left;
+		else
+			link = &parent->right;
+		depth++;
+	}
+	if (!*link)
+		node = binary_tree_node(parent, value);
+	if (node)
+	{
+		*link = node;
+		if (++tree->size > tree->max_size)
+			tree->max_size = tree->size;
+		if (depth > sgt_limit(tree->size))
+			sgt_rebalance(tree, node);
+	}
+	BT_OP_EXIT();
+
+	return (node);
+}
+
+/**
+ * sgt_remove - Removes a value from a scapegoat tree.
+ *
+ * Description: The node is taken out as by bst_remove. Once the tree has
+ *	lost half of its nodes since it was last rebuilt as a whole, it is
+ *	rebuilt again, as its depth may no longer fit its size.
+ *
+ * @tree: Pointer to the tree.
+ * @value: Value to remove.
+ *
+ * Return: 1 if value was removed, 0 if it is not in the tree.
+*/
+int sgt_remove(sgt_t *tree, int value)
+{
+	bst_t *node = tree ? tree->root : NULL;
+
+	BT_OP_ENTER(BT_OP_BST_REMOVE);
+	while (node && BT_CMP(node->n != value))
+		node = BT_CMP(value < node->n) ?
+			BT_HOP(node->left) : BT_HOP(node->right);
+	if (node)
+	{
+		tree->root = bst_unlink(tree->root, node);
+		free(node);
+		BT_COUNT(frees);
+		if (--tree->size < tree->max_size / 2)
+		{
+			tree->root = bst_rebuild(tree->root, tree->size);
+			tree->max_size = tree->size;
+		}
+	}
+	BT_OP_EXIT();
+
+	return (node != NULL);
+}
+
+/**
+ * sgt_rebalance - Rebuilds the subtree of the scapegoat of a node
+ *	inserted too deep.
+ *
+ * Description: Walking up from the new node, the scapegoat is the first
+ *	ancestor that is further from it than the limit of the size of its
+ *	subtree. The root is one, as the node is too deep, so there always
+ *	is one. Subtree sizes are counted on the way up, each level only
+ *	counting the sibling of the node it comes from, so the walk is in
+ *	O(n) for the n nodes of the scapegoat, like its rebuild.
+ *
+ * @tree: Pointer to the tree.
+ * @node: Pointer to the node inserted too deep.
+*/
+void sgt_rebalance(sgt_t *tree, bst_t *node)
+{
+	size_t size = 1, height = 0;
+	bst_t *sibling;
+
+	while (node->parent && height <= sgt_limit(size))
+	{
+		sibling = node->parent->left == node ?
+			node->parent->right : node->parent->left;
+		size += (sibling ? bst_rebuild_flatten(sibling, NULL) : 0) + 1;
+		node = BT_HOP(node->parent);
+		height++;
+	}
+
+	node = bst_rebuild(node, size);
+	if (!node->parent)
+	{
+		tree->root = node;
+		tree->max_size = tree->size;
+	}
+}
+
+/**
+ * sgt_limit - Computes the greatest depth allowed in a scapegoat tree.
+ *
+ * Description: This is about the height of a tree in which no subtree
+ *	holds more than 1/sqrt(2) of the nodes of its parent, so searches
+ *	stay within 2 * log2(n) steps.
+ *
+ * @size: Number of nodes in the tree.
+ *
+ * Return: Twice the binary logarithm of size, rounded down.
+*/
+size_t sgt_limit(size_t size)
+{
+	size_t limit = 0;
+
+	while (size >>= 1)
+		limit += 2;
+
+	return (limit);
+}
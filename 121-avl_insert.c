@@ -1,12 +1,19 @@
 #include "binary_trees.h"
 
 avl_t *insert_value(avl_t *tree, int value);
-avl_t *balance_left(avl_t **node);
-avl_t *balance_right(avl_t **node);
+void avl_insert_fix(avl_t **tree, avl_t *new_node);
+avl_t *avl_rebalance(avl_t *node, avl_t *child, avl_t *grandchild);
+size_t avl_height(const avl_t *tree);
 
 /**
  * avl_insert - Inserts a value in a AVL.
  *
+ * Description: The nodes do not keep their height, so rebalancing
+ *	measures the siblings of the nodes walked up, in time linear in
+ *	their size. Over random insertions the walk stops low in the tree,
+ *	so an insertion is in O(log(n)) amortized, but one that makes the
+ *	tree taller, as into a perfectly balanced tree, is in O(n).
+ *
  * @tree: Double pointer to the root node of the AVL to insert the value.
  * @value: Value to store in the inserted node.
  *
@@ -15,91 +22,104 @@ avl_t *balance_right(avl_t **node);
 */
 avl_t *avl_insert(avl_t **tree, int value)
 {
-	avl_t *new_node, *root, *temp;
-	int balance_factor;
+	avl_t *new_node;
 
+	BT_OP_ENTER(BT_OP_AVL_INSERT);
 	if (!*tree)
 	{
 		*tree = binary_tree_node(NULL, value);
+		BT_OP_EXIT();
 		return (*tree);
 	}
 
 	new_node = insert_value(*tree, value);
-	if (!new_node)
-		return (NULL);
-
-	temp = new_node->parent;
-	while (temp)
-	{
-		root = NULL;
-		balance_factor = binary_tree_balance(temp);
-
-		if (balance_factor > 1)
-			root = balance_left(&temp);
-		else if (balance_factor < -1)
-			root = balance_right(&temp);
-
-		temp = temp->parent;
-
-		if (!temp && root)
-			*tree = root;
-	}
+	if (new_node)
+		avl_insert_fix(tree, new_node);
+	BT_OP_EXIT();
 
 	return (new_node);
 }
 
 /**
- * balance_left - Balances AVL if the left tree is greater than the right.
+ * avl_insert_fix - Rebalances an AVL tree after a leaf was inserted.
  *
- * @node: Double pointer to the root of the tree to balance.
+ * Description: Walking up from the new node, only the ancestors whose
+ *	height grew can become unbalanced. The walk stops at the first one
+ *	whose height did not change, or after the single or double rotation
+ *	that restores the height the subtree had before the insertion, so
+ *	only the siblings of the nodes walked up are measured. Each one is
+ *	measured whole by avl_height, so a walk up to the root is in O(n).
  *
- * Return: Pointer to the root of the tree after balancing.
+ * @tree: Double pointer to the root node of the AVL tree.
+ * @new_node: Pointer to the inserted leaf.
 */
-avl_t *balance_left(avl_t **node)
+void avl_insert_fix(avl_t **tree, avl_t *new_node)
 {
-	int balance_factor;
-	avl_t *root;
+	avl_t *node, *child, *grandchild = NULL;
+	size_t height = 1, sibling_height;
 
-	binary_tree_rotate_left((*node)->left);
-
-	balance_factor = binary_tree_balance((*node)->left);
-	if (balance_factor > 1)
+	for (child = new_node; child && child->parent; child = node)
 	{
-		binary_tree_rotate_right((*node)->left->left);
-		binary_tree_rotate_left((*node)->left);
+		node = child->parent;
+		sibling_height = avl_height(node->left == child ?
+			node->right : node->left);
+		if (sibling_height >= height)
+			break;
+		if (height - sibling_height > 1)
+		{
+			node = avl_rebalance(node, child, grandchild);
+			if (!node->parent)
+				*tree = node;
+			break;
+		}
+		grandchild = child;
+		height++;
 	}
+}
 
-	root = binary_tree_rotate_right(*node);
-	*node = (*node)->parent;
+/**
+ * avl_rebalance - Rotates a node whose child on the path of an insertion
+ *	is two levels taller than its other child.
+ *
+ * @node: Pointer to the unbalanced node.
+ * @child: Pointer to the taller child of node.
+ * @grandchild: Pointer to the taller child of child.
+ *
+ * Return: Pointer to the node taking the place of node.
+*/
+avl_t *avl_rebalance(avl_t *node, avl_t *child, avl_t *grandchild)
+{
+	if (child == node->left)
+	{
+		if (grandchild == child->right)
+			binary_tree_rotate_left(child);
+		return (binary_tree_rotate_right(node));
+	}
 
-	return (root);
+	if (grandchild == child->left)
+		binary_tree_rotate_right(child);
+	return (binary_tree_rotate_left(node));
 }
 
 /**
- * balance_right - Balances AVL if the right tree is greater than the left.
+ * avl_height - Measures the height of an AVL tree.
  *
- * @node: Double pointer to the root of the tree to balance.
+ * @tree: Pointer to the root node of the tree.
  *
- * Return: Pointer to the root of the tree after balancing.
+ * Return: Number of nodes on the longest path from the root down, or 0
+ *	if tree is NULL.
 */
-avl_t *balance_right(avl_t **node)
+size_t avl_height(const avl_t *tree)
 {
-	int balance_factor;
-	avl_t *root;
-
-	binary_tree_rotate_right((*node)->right);
+	size_t left_height, right_height;
 
-	balance_factor = binary_tree_balance((*node)->right);
-	if (balance_factor < -1)
-	{
-		binary_tree_rotate_left((*node)->right->right);
-		binary_tree_rotate_right((*node)->right);
-	}
+	if (!tree)
+		return (0);
 
-	root = binary_tree_rotate_left(*node);
-	*node = (*node)->parent;
+	left_height = avl_height(BT_HOP(tree->left));
+	right_height = avl_height(BT_HOP(tree->right));
 
-	return (root);
+	return ((left_height > right_height ? left_height : right_height) + 1);
 }
 
 /**
@@ -115,8 +135,8 @@ avl_t *insert_value(avl_t *tree, int value)
 {
 	avl_t *new_node;
 
-	if ((!tree->left && value < tree->n) ||
-	(!tree->right && value > tree->n))
+	if ((!tree->left && BT_CMP(value < tree->n)) ||
+	(!tree->right && BT_CMP(value > tree->n)))
 	{
 
 		new_node = binary_tree_node(tree, value);
@@ -132,11 +152,11 @@ avl_t *insert_value(avl_t *tree, int value)
 	}
 	else
 	{
-		if (value == tree->n)
+		if (BT_CMP(value == tree->n))
 			return (NULL);
-		else if (value < tree->n)
-			return (insert_value(tree->left, value));
+		else if (BT_CMP(value < tree->n))
+			return (insert_value(BT_HOP(tree->left), value));
 		else
-			return (insert_value(tree->right, value));
+			return (insert_value(BT_HOP(tree->right), value));
 	}
 }
@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+void avl_batch_fix(bst_t **tree, bst_t *node);
+avl_t *avl_batch_rotate(avl_t *node, avl_t *child, avl_t *grandchild,
+	size_t *height);
+avl_t *avl_batch_rebuild(avl_t *node, size_t *height, size_t *old_height);
+size_t avl_batch_height(const avl_t *tree);
+int bst_batch_compare(const void *a, const void *b);
+size_t bst_rebuild_flatten(bst_t *tree, bst_t **nodes);
+size_t bst_batch_merge(bst_t **tree, const int *values, size_t size,
+	void (*fix)(bst_t **, bst_t *));
+
+/**
+ * avl_insert_batch - Inserts a batch of values in an AVL tree.
+ *
+ * Description: The values are sorted and merged in by bst_batch_merge,
+ *	the tree being rebalanced once for each run of values linked in
+ *	together rather than once for each value. Heights are measured by
+ *	walking whole subtrees, as by avl_insert, so a fix reaching high in
+ *	the tree is in O(n).
+ *
+ * @tree: Double pointer to the root node of the AVL tree.
+ * @values: Array of values to insert, in any order.
+ * @size: Number of values in the array.
+ *
+ * Return: Number of values inserted, values already in the tree or given
+ *	twice being skipped, and the insertion stopping on failure.
+*/
+size_t avl_insert_batch(avl_t **tree, const int *values, size_t size)
+{
+	int *sorted;
+	size_t i, count = 0;
+
+	if (!tree || !values || !size)
+		return (0);
+	sorted = malloc(sizeof(*sorted) * size);
+	if (!sorted)
+		return (0);
+	memcpy(sorted, values, sizeof(*values) * size);
+	qsort(sorted, size, sizeof(*sorted), &bst_batch_compare);
+	for (i = 0; i < size; i++)
+		if (!count || sorted[count - 1] != sorted[i])
+			sorted[count++] = sorted[i];
+
+	BT_OP_ENTER(BT_OP_AVL_INSERT);
+	count = bst_batch_merge(tree, sorted, count, &avl_batch_fix);
+	BT_OP_EXIT();
+	free(sorted);
+
+	return (count);
+}
+
+/**
+ * avl_batch_fix - Rebalances an AVL tree after a perfectly balanced
+ *	subtree was linked in at a leaf.
+ *
+ * Description: Walking up from the new subtree, only the ancestors whose
+ *	height changed can become unbalanced, and the walk stops at the first
+ *	one whose height did not. An ancestor unbalanced by two levels is
+ *	rotated as by avl_insert, but the new subtree may be taller than
+ *	that, in which case an ancestor is rebuilt by avl_batch_rebuild,
+ *	leaving it perfectly balanced, and maybe lower than before, which
+ *	may in turn unbalance an ancestor the other way.
+ *
+ * @tree: Double pointer to the root node of the AVL tree.
+ * @node: Pointer to the root node of the subtree linked in.
+*/
+void avl_batch_fix(bst_t **tree, bst_t *node)
+{
+	size_t height = 0, old_height = 0, sibling;
+	avl_t *parent, *other, *child = NULL;
+
+	for (parent = node; parent; parent = parent->left)
+		height++;
+	while (node->parent && height != old_height)
+	{
+		parent = node->parent;
+		other = parent->left == node ? parent->right : parent->left;
+		sibling = avl_batch_height(other);
+		old_height = (old_height > sibling ? old_height : sibling) + 1;
+		if (height <= sibling + 1 && sibling <= height + 1)
+		{
+			child = height > sibling ? node : NULL;
+			height = (height > sibling ? height : sibling) + 1;
+			node = parent;
+			continue;
+		}
+		if (height == sibling + 2)
+			node = avl_batch_rotate(parent, node, child, &height);
+		else if (sibling == height + 2)
+		{
+			node = avl_batch_rotate(parent, other, NULL, &sibling);
+			height = sibling;
+		}
+		else
+			node = avl_batch_rebuild(parent, &height, &old_height);
+		child = NULL;
+		if (!node->parent)
+			*tree = node;
+	}
+}
+
+/**
+ * avl_batch_rotate - Rotates a node whose child is two levels taller than
+ *	its other child.
+ *
+ * @node: Pointer to the unbalanced node.
+ * @child: Pointer to the taller child of node.
+ * @grandchild: Pointer to the child of child known to be strictly taller
+ *	than the other, or NULL to have them measured.
+ * @height: Pointer to the height of child, updated to the height of the
+ *	rotated subtree.
+ *
+ * Return: Pointer to the node taking the place of node.
+*/
+avl_t *avl_batch_rotate(avl_t *node, avl_t *child, avl_t *grandchild,
+	size_t *height)
+{
+	int left = child == node->left;
+	avl_t *outer = left ? child->left : child->right;
+	avl_t *inner = left ? child->right : child->left;
+	size_t outer_height, inner_height;
+
+	if (!grandchild)
+	{
+		outer_height = avl_batch_height(outer);
+		inner_height = avl_batch_height(inner);
+		grandchild = outer_height >= inner_height ? outer : inner;
+		*height += outer_height == inner_height;
+	}
+	if (grandchild == inner)
+	{
+		if (left)
+			binary_tree_rotate_left(child);
+		else
+			binary_tree_rotate_right(child);
+	}
+
+	return (left ? binary_tree_rotate_right(node) :
+		binary_tree_rotate_left(node));
+}
+
+/**
+ * avl_batch_rebuild - Rebuilds an unbalanced node, or the lowest of its
+ *	ancestors that will be balanced with its sibling once rebuilt.
+ *
+ * Description: A tall subtree linked in low in the tree unbalances all its
+ *	ancestors up to those whose other child is about as tall. Rebuilding
+ *	only the lowest of those would leave the next one unbalanced, so the
+ *	ancestors are counted in until the perfectly balanced height of the
+ *	subtree, from its number of nodes, fits, and that one is rebuilt.
+ *
+ * @node: Pointer to the unbalanced node.
+ * @height: Pointer to store the height of the rebuilt subtree in.
+ * @old_height: Pointer to the height of node before the batch, updated to
+ *	that of the ancestor rebuilt.
+ *
+ * Return: Pointer to the node taking the place of the ancestor rebuilt.
+*/
+avl_t *avl_batch_rebuild(avl_t *node, size_t *height, size_t *old_height)
+{
+	size_t size = bst_rebuild_flatten(node, NULL), bits, sibling;
+	avl_t *other;
+
+	for (bits = 0; size >> bits; bits++)
+		;
+	while (node->parent)
+	{
+		other = node->parent->left == node ?
+			node->parent->right : node->parent->left;
+		sibling = avl_batch_height(other);
+		if (bits <= sibling + 1)
+			break;
+		if (*old_height < sibling)
+			*old_height = sibling;
+		(*old_height)++;
+		size += (other ? bst_rebuild_flatten(other, NULL) : 0) + 1;
+		node = node->parent;
+		for (bits = 0; size >> bits; bits++)
+			;
+	}
+	node = bst_rebuild(node, size);
+	*height = avl_batch_height(node);
+
+	return (node);
+}
+
+/**
+ * avl_batch_height - Measures the height of an AVL tree.
+ *
+ * @tree: Pointer to the root node of the tree.
+ *
+ * Return: Number of nodes on the longest path from the root down, or 0
+ *	if tree is NULL.
+*/
+size_t avl_batch_height(const avl_t *tree)
+{
+	size_t left_height, right_height;
+
+	if (!tree)
+		return (0);
+
+	left_height = avl_batch_height(BT_HOP(tree->left));
+	right_height = avl_batch_height(BT_HOP(tree->right));
+
+	return ((left_height > right_height ? left_height : right_height) + 1);
+}
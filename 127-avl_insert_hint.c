@@ -0,0 +1,50 @@
+#include "binary_trees.h"
+
+void avl_insert_fix(avl_t **tree, avl_t *new_node);
+
+/**
+ * avl_insert_hint - Inserts a value in an AVL tree, starting the search
+ *	for its place from a node close to it.
+ *
+ * Description: The place of value is found by bst_hint_slot, going
+ *	down O(log(d)) levels for a value d values away from hint, after
+ *	going up as far as the root at worst, so in O(log(n)), then the tree
+ *	is rebalanced by avl_insert_fix as by avl_insert, in O(log(n))
+ *	amortized over random insertions and O(n) at worst. Increasing values,
+ *	each inserted with the node of the previous one as hint, are placed
+ *	without going down from the root.
+ *
+ * @tree: Double pointer to the root node of the AVL to insert the value.
+ * @hint: Pointer to any node of the tree, ideally one close to value,
+ *	such as the one returned by the previous insertion, or NULL to start
+ *	from the root.
+ * @value: Value to store in the inserted node.
+ *
+ * Return: Pointer to the newly created node, or NULL if value already
+ *	exists or if failure occurs.
+*/
+avl_t *avl_insert_hint(avl_t **tree, avl_t *hint, int value)
+{
+	avl_t *parent, *new_node = NULL;
+
+	if (!tree)
+		return (NULL);
+
+	BT_OP_ENTER(BT_OP_AVL_INSERT);
+	parent = bst_hint_slot(hint ? hint : *tree, value);
+	if (!parent || parent->n != value)
+		new_node = binary_tree_node(parent, value);
+	if (new_node)
+	{
+		if (!parent)
+			*tree = new_node;
+		else if (value < parent->n)
+			parent->left = new_node;
+		else
+			parent->right = new_node;
+		avl_insert_fix(tree, new_node);
+	}
+	BT_OP_EXIT();
+
+	return (new_node);
+}
@@ -1,14 +1,16 @@
 #include "binary_trees.h"
 
-int is_perfect(const binary_tree_t *tree);
 heap_t *get_parent(heap_t *root, int value);
-size_t max_depth(const binary_tree_t *tree);
-int check_is_full(const binary_tree_t *tree);
+size_t spine_depth(const binary_tree_t *tree, int left);
 void balance_heap(heap_t *root, heap_t *new_node);
 
 /**
  * heap_insert - Inserts a value in a Max Binary Heap.
  *
+ * Description: Finding the free slot of the complete tree walks the
+ *	spines of the subtrees on its way down, so the insertion is in
+ *	O(log^2(n)).
+ *
  * @root: Double pointer to the root node of the heap to insert the value.
  * @value: Value to store in the node to be inserted.
  *
@@ -18,31 +20,37 @@ heap_t *heap_insert(heap_t **root, int value)
 {
 	heap_t *node, *new_node;
 
+	BT_OP_ENTER(BT_OP_HEAP_INSERT);
 	if (!*root)
 	{
 		*root = binary_tree_node(NULL, value);
+		BT_OP_EXIT();
 		return (*root);
 	}
 
 	node = get_parent(*root, value);
 	new_node = binary_tree_node(node, value);
 	if (!new_node)
+	{
+		BT_OP_EXIT();
 		return (NULL);
+	}
 
-	if (node->n > value)
+	if (BT_CMP(node->n >= value))
 	{
 		if (node->left)
 			node->right = new_node;
 		else
 			node->left = new_node;
 	}
-	if (node->n < value)
+	else
 	{
 		balance_heap(node, new_node);
 	}
 
 	if (!new_node->parent)
 		*root = new_node;
+	BT_OP_EXIT();
 
 	return (new_node);
 }
@@ -103,6 +111,11 @@ void balance_heap(heap_t *root, heap_t *new_node)
  *      the new node to insert if the value to insert is greater than the
  *      parent's value. In that case the balancing function is usd to place
  *      each node in its correct position.
+ *      The free slot of a complete tree is on the right exactly when the
+ *      left subtree is perfect and the right one is not as tall, which
+ *      the spines of both subtrees tell. Walking them at each of the
+ *      O(log(n)) levels is O(log^2(n)), as the tree does not keep its size
+ *      to read the path to the slot from.
  *
  * @root: Pointer to the root of the tree.
  * @value: Value of the node to be inserted.
@@ -111,103 +124,40 @@ void balance_heap(heap_t *root, heap_t *new_node)
 */
 heap_t *get_parent(heap_t *root, int value)
 {
-	if (root->n < value || !root->right || !root->left)
-		return (root);
+	size_t depth;
 
-	if (!is_perfect(root->left))
-	{
-		return (get_parent(root->left, value));
-	}
-	else if (!is_perfect(root->right))
+	while (!BT_CMP(root->n < value) && root->left && root->right)
 	{
-		return (get_parent(root->right, value));
-	}
-	else
-	{
-		if (max_depth(root->right) < max_depth(root->left))
-			return (get_parent(root->right, value));
+		depth = spine_depth(root->left, 1);
+		if (spine_depth(root->left, 0) == depth &&
+			spine_depth(root->right, 0) < depth)
+			root = BT_HOP(root->right);
 		else
-			return (get_parent(root->left, value));
+			root = BT_HOP(root->left);
 	}
+
 	return (root);
 }
 
-
 /**
- * is_perfect - Checks if a binary tree is perfect.
- *
- * @tree: Pointer to the root of the binary tree.
+ * spine_depth - Counts the nodes on the leftmost or rightmost path of a
+ *	binary tree.
  *
- * Return: 1 if is perfect, 0 if otherwise.
-*/
-int is_perfect(const binary_tree_t *tree)
-{
-	if (!tree)
-	{
-		return (0);
-	}
-	else
-	{
-		return (check_is_full(tree) &&
-			(max_depth(tree->left) == max_depth(tree->right)));
-	}
-}
-
-/**
- * max_depth - Find the max depth of a binary tree.
+ * Description: In a complete tree the leftmost path is the longest, so
+ *	this is also its max depth, and the tree is perfect exactly when its
+ *	rightmost path is as long.
  *
  * @tree: Pointer to the root of the binary tree.
+ * @left: 1 to follow left children, 0 to follow right children.
  *
- * Return: Max depth of the binary tree.
+ * Return: Number of nodes on the path, 0 if tree is NULL.
 */
-size_t max_depth(const binary_tree_t *tree)
+size_t spine_depth(const binary_tree_t *tree, int left)
 {
-	size_t right_depth, left_depth;
+	size_t depth;
 
-	if (!tree)
-	{
-		return (0);
-	}
-	else
-	{
-		left_depth = max_depth(tree->left);
-		right_depth = max_depth(tree->right);
-
-		if (left_depth > right_depth)
-			return (left_depth + 1);
-		else
-			return (right_depth + 1);
-	}
-}
+	for (depth = 0; tree; depth++)
+		tree = BT_HOP(left ? tree->left : tree->right);
 
-/**
- * check_is_full - Checks if a binary tree is full.
- *
- * @tree: Pointer to the root of the binary tree.
- *
- * Return: 1 if is full, or 0 if otherwise.
-*/
-int check_is_full(const binary_tree_t *tree)
-{
-	int right_leaves, left_leaves;
-
-	if (!tree || (!tree->left && tree->right) ||
-		(tree->left && !tree->right))
-	{
-		return (0);
-	}
-	else if (!tree->left && !tree->right)
-	{
-		return (1);
-	}
-	else
-	{
-		left_leaves = check_is_full(tree->left);
-		if (!left_leaves && tree->left)
-			return (0);
-
-		right_leaves = check_is_full(tree->right);
-
-		return ((left_leaves + right_leaves + 1) % 2);
-	}
+	return (depth);
 }
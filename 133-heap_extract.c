@@ -1,160 +1,118 @@
-#include "binary_trees.h"
 #include <stdlib.h>
-#include <stdio.h>
-
-heap_t *sift_up(heap_t *node);
-void sift_down(heap_t *node, heap_t *root);
-void sift_all_left(heap_t *root);
-void sift_all_right(heap_t *root);
+#include "binary_trees.h"
 
+heap_t *extract_last(heap_t *root);
+size_t extract_depth(const heap_t *tree);
+void extract_sift_down(heap_t *node);
+
+/**
+ * heap_extract - Extracts the root node of a Max Binary Heap.
+ *
+ * Description: The value of the last level-order node replaces the value
+ *	of the root, that node is freed and the value is sifted down, so
+ *	the tree stays complete. Finding that node measures O(log(n))
+ *	leftmost paths of O(log(n)) nodes, so the whole extraction is in
+ *	O(log^2(n)).
+ *
+ * @root: Double pointer to the root node of the heap.
+ *
+ * Return: Value stored in the root node, or 0 on failure.
+*/
 int heap_extract(heap_t **root)
 {
-        heap_t *node;
-        int temp;
-
-        if ((*root)->left->n > (*root)->right->n)
-                node = sift_up((*root)->left);
-        else
-                node = sift_up((*root)->right);
-
-
-        sift_down(node, *root);
-
-        temp = (*root)->n;
-        free(*root);
-        *root = node;
-
-        sift_all_left((*root)->left);
-        sift_all_right((*root)->right);
-        
-        return (temp);
-}
-
-void sift_all_left(heap_t *root)
-{
-        if (!root || (!root->right && !root->left))
-        {
-                return;
-        }
-        else
-        {
-                sift_up(root);
-                sift_all_left(root->left);
-        }
+	heap_t *last;
+	int value;
+
+	if (!root || !*root)
+		return (0);
+
+	BT_OP_ENTER(BT_OP_HEAP_EXTRACT);
+	value = (*root)->n;
+	last = extract_last(*root);
+	if (last == *root)
+	{
+		*root = NULL;
+	}
+	else
+	{
+		if (last->parent->left == last)
+			last->parent->left = NULL;
+		else
+			last->parent->right = NULL;
+		(*root)->n = last->n;
+		extract_sift_down(*root);
+	}
+	free(last);
+	BT_COUNT(frees);
+	BT_OP_EXIT();
+
+	return (value);
 }
 
-void sift_all_right(heap_t *root)
+/**
+ * extract_last - Finds the last level-order node of a complete binary tree.
+ *
+ * Description: The last node is in the right subtree exactly when its
+ *	leftmost path is as long as the one of the left subtree, which
+ *	takes O(log(n)) at each of the O(log(n)) levels.
+ *
+ * @root: Pointer to the root node of the tree.
+ *
+ * Return: Pointer to the last node.
+*/
+heap_t *extract_last(heap_t *root)
 {
-        if (!root || (!root->right && !root->left))
-        {
-                return;
-        }
-        else
-        {
-                sift_all_right(root->right);
-                sift_all_right(root->left);
-                sift_up(root);
-        }
+	size_t depth = extract_depth(root);
+
+	while (root->left)
+	{
+		depth--;
+		if (root->right && extract_depth(root->right) == depth)
+			root = BT_HOP(root->right);
+		else
+			root = BT_HOP(root->left);
+	}
+
+	return (root);
 }
 
-heap_t *sift_up(heap_t *node)
+/**
+ * extract_depth - Counts the nodes on the leftmost path of a binary tree.
+ *
+ * @tree: Pointer to the root node of the tree.
+ *
+ * Return: Number of nodes on the path, 0 if tree is NULL.
+*/
+size_t extract_depth(const heap_t *tree)
 {
-        heap_t *temp, *left, *right;
-
-        if (node->left && node->left->n > node->n)
-        {
-                if (node->right && node->right->n > node->left->n)
-                        return (sift_up(node->right));
-                else
-                        return (sift_up(node->left));
-        }
-        else if (node->right && node->right->n > node->n)
-        {
-                return (sift_up(node->right));
-        }
-
-        if (node->parent && node->parent->parent)
-        {
-                temp = node->parent;
-                left = temp->left;
-                right = temp->right;
-
-                if (node->left)
-                        node->left->parent = temp;
-                if (node->right)
-                        node->right->parent = temp;
-
-                if (temp->parent->left == temp)
-                        temp->parent->left = node;
-                else
-                        temp->parent->right = node;
+	size_t depth;
 
-                node->parent = temp->parent;
-                temp->parent = node;
-                temp->left = node->left;
-                temp->right = node->right;
+	for (depth = 0; tree; depth++)
+		tree = BT_HOP(tree->left);
 
-                if (node == left)
-                {
-                        if (right)
-                                right->parent = node;
-                        node->left = temp;
-                        node->right = right;
-                }
-                else
-                {
-                        if (left)
-                                left->parent = node;
-                        node->right = temp;
-                        node->left = left;
-                }
-        }
-        return (node);
+	return (depth);
 }
 
-void sift_down(heap_t *node, heap_t *root)
+/**
+ * extract_sift_down - Moves the value of a node down a Max Binary Heap
+ *	until both children hold smaller values.
+ *
+ * @node: Pointer to the node whose value is sifted down.
+*/
+void extract_sift_down(heap_t *node)
 {
-        heap_t *temp, *right, *left;
-
-        if (!root)
-                return;
-
-        node->parent = root->parent;
-
-        if (node == root->left)
-        {
-                if (root->right)
-                        root->right->parent = node;
-                right = node->right;
-                node->right = root->right;
-
-                while (right && node->left)
-                {
-                        temp = right;
-                        right = node->left->right;
-                        node->left->right = temp;
-                        temp->parent = node->left;
-                        node = node->left;
-                }
-                if (right && !node->left)
-                        node->left = right;
-        }
-        else
-        {
-                if (root->left)
-                        root->left->parent = node;
-                left = node->left;
-                node->left = root->left;
-
-                while (left && node->right)
-                {
-                        temp = left;
-                        left = node->right->left;
-                        node->right->left = temp;
-                        temp->parent = node->right;
-                        node = node->right;
-                }
-                if (left && !node->right)
-                        node->right = left;
-        }
+	heap_t *child;
+	int value = node->n;
+
+	while (node->left)
+	{
+		child = node->left;
+		if (node->right && BT_CMP(node->right->n > child->n))
+			child = node->right;
+		if (BT_CMP(child->n <= value))
+			break;
+		node->n = child->n;
+		node = BT_HOP(child);
+	}
+	node->n = value;
 }
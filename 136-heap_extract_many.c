@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+heap_t *extract_last(heap_t *root);
+void extract_sift_down(heap_t *node);
+heap_t *heap_level_prev(heap_t *node);
+
+/**
+ * heap_extract_many - Extracts the k largest values of a Max Binary Heap.
+ *
+ * Description: The last level-order node is found once, as by
+ *	heap_extract, in O(log^2(n)). Each value popped is then replaced by
+ *	the one of that node, which is freed and gives way to the node before
+ *	it in level order, found by heap_level_prev in O(log(n)), so the tree
+ *	stays complete and the whole extraction is in O(log^2(n) + k log(n))
+ *	rather than depending on the size of the heap.
+ *
+ * @root: Double pointer to the root node of the heap.
+ * @k: Number of values to extract.
+ * @out: Array where the extracted values are stored, largest first.
+ *
+ * Return: Number of values extracted, or 0 on failure.
+*/
+size_t heap_extract_many(heap_t **root, size_t k, int *out)
+{
+	heap_t *last, *prev;
+	size_t i;
+
+	if (!root || !*root || !out || !k)
+		return (0);
+
+	BT_OP_ENTER(BT_OP_HEAP_EXTRACT);
+	last = extract_last(*root);
+	for (i = 0; i < k && *root; i++)
+	{
+		out[i] = (*root)->n;
+		if (last == *root)
+		{
+			*root = NULL;
+			prev = NULL;
+		}
+		else
+		{
+			prev = heap_level_prev(last);
+			if (last->parent->left == last)
+				last->parent->left = NULL;
+			else
+				last->parent->right = NULL;
+			(*root)->n = last->n;
+			extract_sift_down(*root);
+		}
+		free(last);
+		BT_COUNT(frees);
+		last = prev;
+	}
+	BT_OP_EXIT();
+
+	return (i);
+}
+
+/**
+ * heap_level_prev - Finds the node before a node in the level order of a
+ *	complete binary tree.
+ *
+ * Description: The walk goes up from node while it is a left child. From
+ *	a right child, it goes down the rightmost path of the left sibling to
+ *	the depth of node. From the root, node was the first of its level,
+ *	and the node before it is the last one of the level above, at the end
+ *	of the rightmost path of the tree, which is full down to there.
+ *
+ * @node: Pointer to a node other than the root.
+ *
+ * Return: Pointer to the node before node.
+*/
+heap_t *heap_level_prev(heap_t *node)
+{
+	size_t depth = 0;
+
+	while (node->parent && node->parent->left == node)
+	{
+		node = BT_HOP(node->parent);
+		depth++;
+	}
+	if (node->parent)
+		node = BT_HOP(node->parent->left);
+	else
+		depth--;
+	while (depth--)
+		node = BT_HOP(node->right);
+
+	return (node);
+}
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+void topk_sift_down(int *data, size_t size, size_t index);
+
+/**
+ * heap_topk_create - Creates an accumulator for the k largest values of a
+ *	stream.
+ *
+ * @k: Number of values to keep.
+ *
+ * Return: Pointer to the new accumulator, or NULL on failure or if k is 0.
+*/
+heap_topk_t *heap_topk_create(size_t k)
+{
+	heap_topk_t *acc;
+
+	if (!k)
+		return (NULL);
+
+	acc = malloc(sizeof(*acc));
+	if (!acc)
+		return (NULL);
+
+	acc->data = malloc(sizeof(*acc->data) * k);
+	if (!acc->data)
+	{
+		free(acc);
+		return (NULL);
+	}
+	acc->size = 0;
+	acc->k = k;
+
+	return (acc);
+}
+
+/**
+ * heap_topk_push - Feeds a value from the stream to the accumulator.
+ *
+ * Description: The accumulator is a Min Binary Heap of at most k values,
+ *	so its root is the smallest value kept. Once full, a new value only
+ *	replaces the root if it is larger, in O(log(k)).
+ *
+ * @acc: Pointer to the accumulator.
+ * @value: Value to push.
+ *
+ * Return: 1 if the value is kept, 0 otherwise.
+*/
+int heap_topk_push(heap_topk_t *acc, int value)
+{
+	size_t index, parent;
+
+	if (!acc)
+		return (0);
+
+	if (acc->size == acc->k)
+	{
+		if (value <= acc->data[0])
+			return (0);
+		acc->data[0] = value;
+		topk_sift_down(acc->data, acc->size, 0);
+		return (1);
+	}
+
+	index = acc->size++;
+	while (index)
+	{
+		parent = (index - 1) / 2;
+		if (acc->data[parent] <= value)
+			break;
+		acc->data[index] = acc->data[parent];
+		index = parent;
+	}
+	acc->data[index] = value;
+
+	return (1);
+}
+
+/**
+ * heap_topk_drain - Empties the accumulator into an array.
+ *
+ * @acc: Pointer to the accumulator.
+ * @out: Array of at least k elements where the values are stored,
+ *	largest first.
+ *
+ * Return: Number of values stored in out.
+*/
+size_t heap_topk_drain(heap_topk_t *acc, int *out)
+{
+	size_t count;
+
+	if (!acc || !out)
+		return (0);
+
+	count = acc->size;
+	while (acc->size)
+	{
+		out[acc->size - 1] = acc->data[0];
+		acc->data[0] = acc->data[--acc->size];
+		topk_sift_down(acc->data, acc->size, 0);
+	}
+
+	return (count);
+}
+
+/**
+ * heap_topk_delete - Deletes an accumulator.
+ *
+ * @acc: Pointer to the accumulator to delete.
+*/
+void heap_topk_delete(heap_topk_t *acc)
+{
+	if (acc)
+	{
+		free(acc->data);
+		free(acc);
+	}
+}
+
+/**
+ * topk_sift_down - Moves a value down a Min Binary Heap until both
+ *	children hold larger values.
+ *
+ * @data: Array holding the heap.
+ * @size: Number of values in the heap.
+ * @index: Index of the value to sift down.
+*/
+void topk_sift_down(int *data, size_t size, size_t index)
+{
+	size_t child;
+	int value = data[index];
+
+	while ((child = 2 * index + 1) < size)
+	{
+		if (child + 1 < size && data[child + 1] < data[child])
+			child++;
+		if (data[child] >= value)
+			break;
+		data[index] = data[child];
+		index = child;
+	}
+	data[index] = value;
+}
@@ -0,0 +1,55 @@
+#include "binary_trees.h"
+
+void sort_sift_down(int *array, size_t size, size_t index);
+
+/**
+ * heap_sort - Sorts an array of integers in ascending order, in place,
+ *	using an array Max Binary Heap.
+ *
+ * @array: Pointer to the first element of the array.
+ * @size: Number of elements in the array.
+*/
+void heap_sort(int *array, size_t size)
+{
+	size_t i;
+	int temp;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = size / 2; i > 0; i--)
+		sort_sift_down(array, size, i - 1);
+
+	for (i = size - 1; i > 0; i--)
+	{
+		temp = array[0];
+		array[0] = array[i];
+		array[i] = temp;
+		sort_sift_down(array, i, 0);
+	}
+}
+
+/**
+ * sort_sift_down - Moves a value down an array Max Binary Heap until both
+ *	children hold smaller values.
+ *
+ * @array: Array holding the heap.
+ * @size: Number of values in the heap.
+ * @index: Index of the value to sift down.
+*/
+void sort_sift_down(int *array, size_t size, size_t index)
+{
+	size_t child;
+	int value = array[index];
+
+	while ((child = 2 * index + 1) < size)
+	{
+		if (child + 1 < size && BT_CMP(array[child + 1] > array[child]))
+			child++;
+		if (BT_CMP(array[child] <= value))
+			break;
+		array[index] = array[child];
+		index = child;
+	}
+	array[index] = value;
+}
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+void merge_sift_down(size_t *heap, size_t size, size_t index,
+	int **runs, size_t *pos);
+
+/**
+ * heap_merge - Merges sorted arrays of integers into one sorted array.
+ *
+ * Description: The runs are kept in an array Min Binary Heap ordered by
+ *	their next value, so each value written costs O(log(k)).
+ *
+ * @runs: Array of pointers to the sorted arrays to merge.
+ * @sizes: Number of elements in each sorted array.
+ * @k: Number of sorted arrays.
+ * @out: Array large enough to hold every element of every run.
+ *
+ * Return: Number of elements written to out.
+*/
+size_t heap_merge(int **runs, size_t *sizes, size_t k, int *out)
+{
+	size_t *heap, *pos, size = 0, count = 0, i, run;
+
+	if (!runs || !sizes || !out || !k)
+		return (0);
+
+	heap = malloc(sizeof(*heap) * k * 2);
+	if (!heap)
+		return (0);
+	pos = heap + k;
+
+	for (i = 0; i < k; i++)
+	{
+		pos[i] = 0;
+		if (runs[i] && sizes[i])
+			heap[size++] = i;
+	}
+	for (i = size / 2; i > 0; i--)
+		merge_sift_down(heap, size, i - 1, runs, pos);
+
+	while (size)
+	{
+		run = heap[0];
+		out[count++] = runs[run][pos[run]++];
+		if (pos[run] == sizes[run])
+			heap[0] = heap[--size];
+		merge_sift_down(heap, size, 0, runs, pos);
+	}
+
+	free(heap);
+	return (count);
+}
+
+/**
+ * merge_sift_down - Moves a run down the Min Binary Heap until both
+ *	children have larger next values.
+ *
+ * @heap: Array holding the heap of run indexes.
+ * @size: Number of runs in the heap.
+ * @index: Index in the heap of the run to sift down.
+ * @runs: Array of pointers to the sorted arrays.
+ * @pos: Position of the next value in each run.
+*/
+void merge_sift_down(size_t *heap, size_t size, size_t index,
+	int **runs, size_t *pos)
+{
+	size_t child, run;
+	int value;
+
+	if (!size)
+		return;
+
+	run = heap[index];
+	value = runs[run][pos[run]];
+	while ((child = 2 * index + 1) < size)
+	{
+		if (child + 1 < size && runs[heap[child + 1]][pos[heap[child + 1]]] <
+			runs[heap[child]][pos[heap[child]]])
+			child++;
+		if (runs[heap[child]][pos[heap[child]]] >= value)
+			break;
+		heap[index] = heap[child];
+		index = child;
+	}
+	heap[index] = run;
+}
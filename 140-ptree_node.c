@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/**
+ * ptree_node - Creates a node of a persistent tree.
+ *
+ * Description: The new node takes over the references to left and right
+ *	held by the caller. On failure those references are released.
+ *
+ * @left: Pointer to the left child node.
+ * @value: Value to put in the new node.
+ * @right: Pointer to the right child node.
+ *
+ * Return: Pointer to the new node, holding one reference, or NULL on failure.
+*/
+ptree_t *ptree_node(ptree_t *left, int value, ptree_t *right)
+{
+	ptree_t *new_node = malloc(sizeof(ptree_t));
+	int left_height = ptree_height(left), right_height = ptree_height(right);
+
+	if (!new_node)
+	{
+		ptree_release(left);
+		ptree_release(right);
+		return (NULL);
+	}
+
+	new_node->n = value;
+	new_node->left = left;
+	new_node->right = right;
+	new_node->refs = 1;
+	new_node->height = 1 + (left_height > right_height ?
+		left_height : right_height);
+
+	return (new_node);
+}
+
+/**
+ * ptree_retain - Takes a new reference to a persistent tree.
+ *
+ * @tree: Pointer to the root node of the tree.
+ *
+ * Return: Pointer to the root node of the tree.
+*/
+ptree_t *ptree_retain(ptree_t *tree)
+{
+	if (tree)
+		__atomic_add_fetch(&tree->refs, 1, __ATOMIC_RELAXED);
+
+	return (tree);
+}
+
+/**
+ * ptree_release - Drops a reference to a persistent tree.
+ *
+ * Description: Nodes no longer referenced by any version are freed, the
+ *	ones still shared with other versions are left untouched. A node
+ *	about to be freed belongs to no one else, so its left pointer links
+ *	it into a stack of nodes whose right subtree is still to release,
+ *	which takes no memory and no recursion however deep the tree is.
+ *
+ * @tree: Pointer to the root node of the tree.
+*/
+void ptree_release(ptree_t *tree)
+{
+	ptree_t *stack = NULL, *left;
+
+	while (tree || stack)
+	{
+		if (tree && __atomic_sub_fetch(&tree->refs, 1,
+			__ATOMIC_ACQ_REL) == 0)
+		{
+			left = tree->left;
+			tree->left = stack;
+			stack = tree;
+			tree = left;
+			continue;
+		}
+		if (!stack)
+			break;
+		tree = stack->right;
+		left = stack->left;
+		free(stack);
+		stack = left;
+	}
+}
+
+/**
+ * ptree_search - Searches for a value in a version of a persistent tree.
+ *
+ * @tree: Pointer to the root node of the version to search.
+ * @value: Value to search in the tree.
+ *
+ * Return: Pointer to the node containing value, or NULL if nothing is found.
+*/
+ptree_t *ptree_search(const ptree_t *tree, int value)
+{
+	while (tree && tree->n != value)
+		tree = (value < tree->n) ? tree->left : tree->right;
+
+	return ((ptree_t *)tree);
+}
+
+/**
+ * ptree_height - Gets the height of a persistent tree.
+ *
+ * @tree: Pointer to the root node of the tree.
+ *
+ * Return: The height of the tree, 0 if tree is NULL.
+*/
+int ptree_height(const ptree_t *tree)
+{
+	return (tree ? tree->height : 0);
+}
@@ -0,0 +1,107 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+ptree_t *ptree_insert_value(ptree_t *tree, int value,
+	ptree_t *(*make)(ptree_t *, int, ptree_t *));
+ptree_t **ptree_path(const ptree_t *tree, ptree_t **stack);
+
+/**
+ * pbst_insert - Inserts a value in a persistent BST.
+ *
+ * Description: Only the nodes on the path to the new node are copied, the
+ *	rest of the tree is shared with the previous version, which is left
+ *	unchanged.
+ *
+ * @root: Pointer to the root node of the version to insert the value in.
+ * @value: Value to store in the inserted node.
+ *
+ * Return: Pointer to the root node of the new version, or NULL on failure.
+ *	If value already exists, a new reference to root is returned.
+*/
+ptree_t *pbst_insert(ptree_t *root, int value)
+{
+	if (ptree_search(root, value))
+		return (ptree_retain(root));
+
+	return (ptree_insert_value(root, value, &ptree_node));
+}
+
+/**
+ * pavl_insert - Inserts a value in a persistent AVL tree.
+ *
+ * Description: The copied path is rebalanced as it is rebuilt, the
+ *	previous version is left unchanged.
+ *
+ * @root: Pointer to the root node of the version to insert the value in.
+ * @value: Value to store in the inserted node.
+ *
+ * Return: Pointer to the root node of the new version, or NULL on failure.
+ *	If value already exists, a new reference to root is returned.
+*/
+ptree_t *pavl_insert(ptree_t *root, int value)
+{
+	if (ptree_search(root, value))
+		return (ptree_retain(root));
+
+	return (ptree_insert_value(root, value, &pavl_node));
+}
+
+/**
+ * ptree_insert_value - Copies the path to a new value of a persistent tree.
+ *
+ * Description: The path from tree down to the place of value is recorded
+ *	on the way down, then copied from the bottom up, each copy taking the
+ *	one below it as a child and sharing the other child with tree.
+ *
+ * @tree: Pointer to the root of the tree, which must not contain value.
+ * @value: Value of the new node to insert.
+ * @make: Pointer to the function building each copied node.
+ *
+ * Return: Pointer to the root of the new tree, or NULL on failure.
+*/
+ptree_t *ptree_insert_value(ptree_t *tree, int value,
+	ptree_t *(*make)(ptree_t *, int, ptree_t *))
+{
+	ptree_t *stack[PTREE_PATH_MAX], **path, *child;
+	size_t depth = 0;
+
+	path = ptree_path(tree, stack);
+	if (!path)
+		return (NULL);
+	for (; tree; tree = value < tree->n ? tree->left : tree->right)
+		path[depth++] = tree;
+
+	child = ptree_node(NULL, value, NULL);
+	while (child && depth--)
+	{
+		tree = path[depth];
+		if (value < tree->n)
+			child = make(child, tree->n, ptree_retain(tree->right));
+		else
+			child = make(ptree_retain(tree->left), tree->n, child);
+	}
+	if (path != stack)
+		free(path);
+
+	return (child);
+}
+
+/**
+ * ptree_path - Provides an array to record a path of a persistent tree in.
+ *
+ * Description: No path is longer than the height kept in the root, so
+ *	the array on the stack of the caller is enough unless the tree, an
+ *	unbalanced persistent BST, is higher than PTREE_PATH_MAX.
+ *
+ * @tree: Pointer to the root of the tree.
+ * @stack: Array of PTREE_PATH_MAX pointers owned by the caller.
+ *
+ * Return: stack, or an array to free, or NULL on failure.
+*/
+ptree_t **ptree_path(const ptree_t *tree, ptree_t **stack)
+{
+	if (ptree_height(tree) <= PTREE_PATH_MAX)
+		return (stack);
+
+	return (malloc(sizeof(*stack) * ptree_height(tree)));
+}
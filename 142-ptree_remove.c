@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+ptree_t *ptree_remove_value(ptree_t *tree, int value,
+	ptree_t *(*make)(ptree_t *, int, ptree_t *));
+ptree_t **ptree_path(const ptree_t *tree, ptree_t **stack);
+
+/**
+ * pbst_remove - Removes a value from a persistent BST.
+ *
+ * Description: If the node to remove has two children, it is replaced
+ *	with its first in-order successor. The previous version is left
+ *	unchanged.
+ *
+ * @root: Pointer to the root node of the version to remove the value from.
+ * @value: Value to remove from the tree.
+ *
+ * Return: Pointer to the root node of the new version, or NULL if it is
+ *	empty or on failure. If value is not found, a new reference to root
+ *	is returned.
+*/
+ptree_t *pbst_remove(ptree_t *root, int value)
+{
+	if (!ptree_search(root, value))
+		return (ptree_retain(root));
+
+	return (ptree_remove_value(root, value, &ptree_node));
+}
+
+/**
+ * pavl_remove - Removes a value from a persistent AVL tree.
+ *
+ * @root: Pointer to the root node of the version to remove the value from.
+ * @value: Value to remove from the tree.
+ *
+ * Return: Pointer to the root node of the new version, or NULL if it is
+ *	empty or on failure. If value is not found, a new reference to root
+ *	is returned.
+*/
+ptree_t *pavl_remove(ptree_t *root, int value)
+{
+	if (!ptree_search(root, value))
+		return (ptree_retain(root));
+
+	return (ptree_remove_value(root, value, &pavl_node));
+}
+
+/**
+ * ptree_remove_value - Copies the path to a value removed from a
+ *	persistent tree.
+ *
+ * Description: The path down to value is recorded, and on to its
+ *	in-order successor if its node has two children, the successor then
+ *	being the node removed and its value moving up. The nodes of the path
+ *	above the one removed are copied from the bottom up, each one on the
+ *	side of the removed value, so of the successor, sharing its other
+ *	child with tree.
+ *
+ * @tree: Pointer to the root of the tree, which must contain value.
+ * @value: Value to remove.
+ * @make: Pointer to the function building each copied node.
+ *
+ * Return: Pointer to the root of the new tree, or NULL if it is empty or
+ *	on failure.
+*/
+ptree_t *ptree_remove_value(ptree_t *tree, int value,
+	ptree_t *(*make)(ptree_t *, int, ptree_t *))
+{
+	ptree_t *stack[PTREE_PATH_MAX], **path, *node, *target, *child;
+	size_t depth = 0;
+
+	path = ptree_path(tree, stack);
+	if (!path)
+		return (NULL);
+	for (node = tree; node->n != value;)
+	{
+		path[depth++] = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	target = node;
+	path[depth++] = node;
+	if (node->left && node->right)
+		for (node = node->right; node; node = node->left)
+			path[depth++] = node;
+
+	node = path[--depth];
+	value = node->n;
+	child = ptree_retain(node->left ? node->left : node->right);
+	while (depth--)
+	{
+		node = path[depth];
+		if (value < node->n)
+			child = make(child, node->n, ptree_retain(node->right));
+		else
+			child = make(ptree_retain(node->left),
+				node == target ? value : node->n, child);
+		if (!child)
+			break;
+	}
+	if (path != stack)
+		free(path);
+
+	return (child);
+}
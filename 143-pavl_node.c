@@ -0,0 +1,107 @@
+#include "binary_trees.h"
+
+ptree_t *pavl_rotate_right(ptree_t *left, int value, ptree_t *right);
+ptree_t *pavl_rotate_left(ptree_t *left, int value, ptree_t *right);
+
+/**
+ * pavl_node - Creates a node of a persistent AVL tree, rebalancing it if
+ *	the heights of its children differ by two.
+ *
+ * Description: Like ptree_node, the references to left and right held by
+ *	the caller are taken over by the new subtree.
+ *
+ * @left: Pointer to the left child node.
+ * @value: Value to put in the new node.
+ * @right: Pointer to the right child node.
+ *
+ * Return: Pointer to the root of the new subtree, or NULL on failure.
+*/
+ptree_t *pavl_node(ptree_t *left, int value, ptree_t *right)
+{
+	int balance = ptree_height(left) - ptree_height(right);
+
+	if (balance > 1)
+		return (pavl_rotate_right(left, value, right));
+	else if (balance < -1)
+		return (pavl_rotate_left(left, value, right));
+
+	return (ptree_node(left, value, right));
+}
+
+/**
+ * pavl_rotate_right - Builds a right rotated copy of a subtree whose left
+ *	child is too high.
+ *
+ * @left: Pointer to the left child node, used only for its children.
+ * @value: Value of the root of the subtree before rotation.
+ * @right: Pointer to the right child node.
+ *
+ * Return: Pointer to the root of the new subtree, or NULL on failure.
+*/
+ptree_t *pavl_rotate_right(ptree_t *left, int value, ptree_t *right)
+{
+	ptree_t *root, *lower_left, *lower_right, *pivot = left->right;
+
+	if (ptree_height(left->left) >= ptree_height(pivot))
+	{
+		lower_right = ptree_node(ptree_retain(pivot), value, right);
+		root = lower_right ? ptree_node(ptree_retain(left->left),
+			left->n, lower_right) : NULL;
+	}
+	else
+	{
+		lower_left = ptree_node(ptree_retain(left->left), left->n,
+			ptree_retain(pivot->left));
+		lower_right = ptree_node(ptree_retain(pivot->right), value, right);
+		if (lower_left && lower_right)
+			root = ptree_node(lower_left, pivot->n, lower_right);
+		else
+		{
+			ptree_release(lower_left);
+			ptree_release(lower_right);
+			root = NULL;
+		}
+	}
+
+	ptree_release(left);
+	return (root);
+}
+
+/**
+ * pavl_rotate_left - Builds a left rotated copy of a subtree whose right
+ *	child is too high.
+ *
+ * @left: Pointer to the left child node.
+ * @value: Value of the root of the subtree before rotation.
+ * @right: Pointer to the right child node, used only for its children.
+ *
+ * Return: Pointer to the root of the new subtree, or NULL on failure.
+*/
+ptree_t *pavl_rotate_left(ptree_t *left, int value, ptree_t *right)
+{
+	ptree_t *root, *lower_left, *lower_right, *pivot = right->left;
+
+	if (ptree_height(right->right) >= ptree_height(pivot))
+	{
+		lower_left = ptree_node(left, value, ptree_retain(pivot));
+		root = lower_left ? ptree_node(lower_left, right->n,
+			ptree_retain(right->right)) : NULL;
+	}
+	else
+	{
+		lower_left = ptree_node(left, value, ptree_retain(pivot->left));
+		lower_right = ptree_node(ptree_retain(pivot->right), right->n,
+			ptree_retain(right->right));
+		if (lower_left && lower_right)
+			root = ptree_node(lower_left, pivot->n, lower_right);
+		else
+		{
+			ptree_release(lower_left);
+			ptree_release(lower_right);
+			root = NULL;
+		}
+	}
+
+	ptree_release(right);
+	return (root);
+}
@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+cbst_node_t *cbst_node(int value);
+
+/**
+ * cbst_create - Creates an empty thread-safe BST.
+ *
+ * Return: Pointer to the new tree, or NULL on failure.
+*/
+cbst_t *cbst_create(void)
+{
+	cbst_t *tree = malloc(sizeof(cbst_t));
+
+	if (!tree)
+		return (NULL);
+
+	tree->root = NULL;
+	pthread_mutex_init(&tree->lock, NULL);
+
+	return (tree);
+}
+
+/**
+ * cbst_search - Searches for a value in a thread-safe BST.
+ *
+ * Description: Locks are taken hand over hand: the lock of a child is
+ *	acquired before the lock of its parent is released, so the path
+ *	cannot be changed under the search.
+ *
+ * @tree: Pointer to the tree to search.
+ * @value: Value to search in the tree.
+ *
+ * Return: 1 if value is found, 0 otherwise.
+*/
+int cbst_search(cbst_t *tree, int value)
+{
+	pthread_mutex_t *held;
+	cbst_node_t *node;
+
+	if (!tree)
+		return (0);
+
+	pthread_mutex_lock(&tree->lock);
+	held = &tree->lock;
+	for (node = tree->root; node;)
+	{
+		pthread_mutex_lock(&node->lock);
+		pthread_mutex_unlock(held);
+		held = &node->lock;
+		if (node->n == value)
+			break;
+		node = (value < node->n) ? node->left : node->right;
+	}
+	pthread_mutex_unlock(held);
+
+	return (node != NULL);
+}
+
+/**
+ * cbst_insert - Inserts a value in a thread-safe BST.
+ *
+ * @tree: Pointer to the tree to insert the value in.
+ * @value: Value to store in the inserted node.
+ *
+ * Return: 1 if value is inserted, 0 if it already exists or on failure.
+*/
+int cbst_insert(cbst_t *tree, int value)
+{
+	pthread_mutex_t *held;
+	cbst_node_t **link, *node;
+	int inserted = 0;
+
+	if (!tree)
+		return (0);
+
+	pthread_mutex_lock(&tree->lock);
+	held = &tree->lock;
+	link = &tree->root;
+	for (node = *link; node; node = *link)
+	{
+		pthread_mutex_lock(&node->lock);
+		pthread_mutex_unlock(held);
+		held = &node->lock;
+		if (node->n == value)
+			break;
+		link = (value < node->n) ? &node->left : &node->right;
+	}
+	if (!node)
+	{
+		*link = cbst_node(value);
+		inserted = (*link != NULL);
+	}
+	pthread_mutex_unlock(held);
+
+	return (inserted);
+}
+
+/**
+ * cbst_node - Creates a node of a thread-safe BST.
+ *
+ * @value: Value to put in the new node.
+ *
+ * Return: Pointer to the new node, or NULL on failure.
+*/
+cbst_node_t *cbst_node(int value)
+{
+	cbst_node_t *new_node = malloc(sizeof(cbst_node_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->n = value;
+	new_node->left = NULL;
+	new_node->right = NULL;
+	pthread_mutex_init(&new_node->lock, NULL);
+
+	return (new_node);
+}
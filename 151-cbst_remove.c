@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+void cbst_replace_by_successor(cbst_node_t *node);
+void cbst_delete_nodes(cbst_node_t *node);
+
+/**
+ * cbst_remove - Removes a value from a thread-safe BST.
+ *
+ * Description: The node to remove is reached hand over hand, and its parent
+ *	stays locked while it is unlinked. If it has two children it takes
+ *	the value of its in-order successor, which is unlinked instead.
+ *
+ * @tree: Pointer to the tree to remove the value from.
+ * @value: Value to remove from the tree.
+ *
+ * Return: 1 if value is removed, 0 if it is not found.
+*/
+int cbst_remove(cbst_t *tree, int value)
+{
+	pthread_mutex_t *held;
+	cbst_node_t **link, *node;
+
+	if (!tree)
+		return (0);
+
+	pthread_mutex_lock(&tree->lock);
+	held = &tree->lock;
+	link = &tree->root;
+	for (node = *link; node; node = *link)
+	{
+		pthread_mutex_lock(&node->lock);
+		if (node->n == value)
+			break;
+		pthread_mutex_unlock(held);
+		held = &node->lock;
+		link = (value < node->n) ? &node->left : &node->right;
+	}
+	if (node && node->left && node->right)
+	{
+		pthread_mutex_unlock(held);
+		cbst_replace_by_successor(node);
+		return (1);
+	}
+	if (node)
+	{
+		*link = node->left ? node->left : node->right;
+		pthread_mutex_unlock(&node->lock);
+		pthread_mutex_destroy(&node->lock);
+		free(node);
+	}
+	pthread_mutex_unlock(held);
+
+	return (node != NULL);
+}
+
+/**
+ * cbst_replace_by_successor - Replaces the value of a node with two
+ *	children by its in-order successor, and unlinks the successor.
+ *
+ * @node: Pointer to the locked node to replace, released on return.
+*/
+void cbst_replace_by_successor(cbst_node_t *node)
+{
+	cbst_node_t **link = &node->right, *successor = node->right;
+	pthread_mutex_t *held = &node->lock;
+
+	pthread_mutex_lock(&successor->lock);
+	while (successor->left)
+	{
+		pthread_mutex_lock(&successor->left->lock);
+		if (held != &node->lock)
+			pthread_mutex_unlock(held);
+		held = &successor->lock;
+		link = &successor->left;
+		successor = successor->left;
+	}
+
+	node->n = successor->n;
+	*link = successor->right;
+
+	pthread_mutex_unlock(&successor->lock);
+	pthread_mutex_destroy(&successor->lock);
+	free(successor);
+	if (held != &node->lock)
+		pthread_mutex_unlock(held);
+	pthread_mutex_unlock(&node->lock);
+}
+
+/**
+ * cbst_delete - Deletes a thread-safe BST.
+ *
+ * Description: No other thread may use the tree while it is deleted.
+ *
+ * @tree: Pointer to the tree to delete.
+*/
+void cbst_delete(cbst_t *tree)
+{
+	if (tree)
+	{
+		cbst_delete_nodes(tree->root);
+		pthread_mutex_destroy(&tree->lock);
+		free(tree);
+	}
+}
+
+/**
+ * cbst_delete_nodes - Deletes every node of a thread-safe BST.
+ *
+ * Description: Each left child is rotated up until the node has none,
+ *	then the node is freed and its right child is next, so the walk needs
+ *	no stack however deep the tree is.
+ *
+ * @node: Pointer to the root node of the subtree to delete.
+*/
+void cbst_delete_nodes(cbst_node_t *node)
+{
+	cbst_node_t *next;
+
+	while (node)
+	{
+		next = node->left;
+		if (next)
+		{
+			node->left = next->right;
+			next->right = node;
+		}
+		else
+		{
+			next = node->right;
+			pthread_mutex_destroy(&node->lock);
+			free(node);
+		}
+		node = next;
+	}
+}
@@ -0,0 +1,155 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+lfbst_node_t *lfbst_node(int value, int inf, lfbst_node_t *left,
+	lfbst_node_t *right);
+void lfbst_seek(lfbst_t *tree, int value, lfbst_seek_t *record);
+int lfbst_goes_left(int value, const lfbst_node_t *node);
+void lfbst_epoch_enter(lfbst_t *tree, int tid);
+void lfbst_epoch_exit(lfbst_t *tree, int tid);
+
+/**
+ * lfbst_create - Creates an empty lock-free external BST.
+ *
+ * Description: Values are only stored in leaves, internal nodes route the
+ *	searches. The tree starts with two sentinel internal nodes and three
+ *	sentinel leaves holding values greater than every integer, so every
+ *	leaf has a parent and a grandparent.
+ *
+ * Return: Pointer to the new tree, or NULL on failure.
+*/
+lfbst_t *lfbst_create(void)
+{
+	lfbst_t *tree;
+	lfbst_node_t *leaves[3], *inner = NULL;
+	int i;
+
+	if (posix_memalign((void **)&tree, BT_CACHE_LINE, sizeof(lfbst_t)))
+		return (NULL);
+	memset(tree, 0, sizeof(lfbst_t));
+
+	for (i = 0; i < 3; i++)
+		leaves[i] = lfbst_node(0, i + 1, NULL, NULL);
+	if (leaves[0] && leaves[1] && leaves[2])
+		inner = lfbst_node(0, 2, leaves[0], leaves[1]);
+	if (inner)
+		tree->root = lfbst_node(0, 3, inner, leaves[2]);
+	if (!tree->root)
+	{
+		for (i = 0; i < 3; i++)
+			free(leaves[i]);
+		free(inner);
+		free(tree);
+		return (NULL);
+	}
+
+	return (tree);
+}
+
+/**
+ * lfbst_node - Creates a node of a lock-free external BST.
+ *
+ * @value: Value to put in the new node.
+ * @inf: Rank of the sentinel value to put in the node, 0 for value.
+ * @left: Pointer to the left child node, NULL for a leaf.
+ * @right: Pointer to the right child node, NULL for a leaf.
+ *
+ * Return: Pointer to the new node, or NULL on failure.
+*/
+lfbst_node_t *lfbst_node(int value, int inf, lfbst_node_t *left,
+	lfbst_node_t *right)
+{
+	lfbst_node_t *new_node = malloc(sizeof(lfbst_node_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->n = value;
+	new_node->inf = inf;
+	new_node->left = (uintptr_t)left;
+	new_node->right = (uintptr_t)right;
+	new_node->retired = NULL;
+
+	return (new_node);
+}
+
+/**
+ * lfbst_search - Searches for a value in a lock-free external BST.
+ *
+ * @tree: Pointer to the tree to search.
+ * @value: Value to search in the tree.
+ * @tid: Id of the calling thread, lower than LFBST_MAX_THREADS.
+ *
+ * Return: 1 if value is found, 0 otherwise or if tid is out of range.
+*/
+int lfbst_search(lfbst_t *tree, int value, int tid)
+{
+	lfbst_seek_t record;
+	int found;
+
+	if (!tree || tid < 0 || tid >= LFBST_MAX_THREADS)
+		return (0);
+
+	lfbst_epoch_enter(tree, tid);
+	lfbst_seek(tree, value, &record);
+	found = (!record.leaf->inf && record.leaf->n == value);
+	lfbst_epoch_exit(tree, tid);
+
+	return (found);
+}
+
+/**
+ * lfbst_seek - Walks a lock-free external BST down to the leaf where a
+ *	value is or would be.
+ *
+ * Description: Besides the leaf and its parent, the record keeps the last
+ *	edge of the path that is not tagged, from ancestor to successor. A
+ *	pending removal unlinks everything below that edge at once.
+ *
+ * @tree: Pointer to the tree.
+ * @value: Value to walk to.
+ * @record: Pointer to the record to fill.
+*/
+void lfbst_seek(lfbst_t *tree, int value, lfbst_seek_t *record)
+{
+	uintptr_t parent_field, current_field, *next;
+	lfbst_node_t *current;
+
+	record->ancestor = tree->root;
+	record->successor = LFBST_ADDR(__atomic_load_n(&tree->root->left,
+		__ATOMIC_ACQUIRE));
+	record->parent = record->successor;
+	parent_field = __atomic_load_n(&record->parent->left, __ATOMIC_ACQUIRE);
+	record->leaf = LFBST_ADDR(parent_field);
+	current_field = __atomic_load_n(&record->leaf->left, __ATOMIC_ACQUIRE);
+
+	for (current = LFBST_ADDR(current_field); current;
+		current = LFBST_ADDR(current_field))
+	{
+		if (!(parent_field & LFBST_TAG))
+		{
+			record->ancestor = record->parent;
+			record->successor = record->leaf;
+		}
+		record->parent = record->leaf;
+		record->leaf = current;
+		parent_field = current_field;
+		next = lfbst_goes_left(value, current) ?
+			&current->left : &current->right;
+		current_field = __atomic_load_n(next, __ATOMIC_ACQUIRE);
+	}
+}
+
+/**
+ * lfbst_goes_left - Checks if a value is routed to the left of a node.
+ *
+ * @value: Value to route.
+ * @node: Pointer to the node.
+ *
+ * Return: 1 if value is lower than the value of node, 0 otherwise.
+*/
+int lfbst_goes_left(int value, const lfbst_node_t *node)
+{
+	return (node->inf || value < node->n);
+}
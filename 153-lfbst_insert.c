@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+lfbst_node_t *lfbst_node(int value, int inf, lfbst_node_t *left,
+	lfbst_node_t *right);
+void lfbst_seek(lfbst_t *tree, int value, lfbst_seek_t *record);
+int lfbst_goes_left(int value, const lfbst_node_t *node);
+void lfbst_epoch_enter(lfbst_t *tree, int tid);
+void lfbst_epoch_exit(lfbst_t *tree, int tid);
+int lfbst_cleanup(lfbst_t *tree, int value, lfbst_seek_t *record, int tid);
+void lfbst_delete_nodes(lfbst_node_t *node);
+void lfbst_free_limbo(lfbst_epoch_t *thread, int epoch);
+
+/**
+ * lfbst_insert - Inserts a value in a lock-free external BST.
+ *
+ * Description: The leaf where the value belongs is replaced, with a single
+ *	compare-and-swap on the child pointer of its parent, by a new internal
+ *	node whose children are the old leaf and the new one. If the edge is
+ *	marked by a pending removal, that removal is completed first.
+ *
+ * @tree: Pointer to the tree to insert the value in.
+ * @value: Value to store in the inserted leaf.
+ * @tid: Id of the calling thread, lower than LFBST_MAX_THREADS.
+ *
+ * Return: 1 if value is inserted, 0 if it already exists, if tid is out
+ *	of range or on failure.
+*/
+int lfbst_insert(lfbst_t *tree, int value, int tid)
+{
+	lfbst_seek_t record;
+	lfbst_node_t *leaf, *new_leaf, *inner;
+	uintptr_t *child, expected;
+
+	if (!tree || tid < 0 || tid >= LFBST_MAX_THREADS)
+		return (0);
+
+	lfbst_epoch_enter(tree, tid);
+	while (1)
+	{
+		lfbst_seek(tree, value, &record);
+		leaf = record.leaf;
+		if (!leaf->inf && leaf->n == value)
+			break;
+
+		child = lfbst_goes_left(value, record.parent) ?
+			&record.parent->left : &record.parent->right;
+		new_leaf = lfbst_node(value, 0, NULL, NULL);
+		inner = lfbst_goes_left(value, leaf) ?
+			lfbst_node(leaf->n, leaf->inf, new_leaf, leaf) :
+			lfbst_node(value, 0, leaf, new_leaf);
+		if (!new_leaf || !inner)
+		{
+			free(new_leaf);
+			free(inner);
+			break;
+		}
+
+		expected = (uintptr_t)leaf;
+		if (__atomic_compare_exchange_n(child, &expected,
+			(uintptr_t)inner, 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			lfbst_epoch_exit(tree, tid);
+			return (1);
+		}
+		free(new_leaf);
+		free(inner);
+		if (LFBST_ADDR(expected) == leaf &&
+			(expected & (LFBST_FLAG | LFBST_TAG)))
+			lfbst_cleanup(tree, value, &record, tid);
+	}
+	lfbst_epoch_exit(tree, tid);
+
+	return (0);
+}
+
+/**
+ * lfbst_delete - Deletes a lock-free external BST.
+ *
+ * Description: No other thread may use the tree while it is deleted.
+ *
+ * @tree: Pointer to the tree to delete.
+*/
+void lfbst_delete(lfbst_t *tree)
+{
+	int tid, epoch;
+
+	if (!tree)
+		return;
+
+	for (tid = 0; tid < LFBST_MAX_THREADS; tid++)
+	{
+		for (epoch = 0; epoch < 3; epoch++)
+			lfbst_free_limbo(&tree->threads[tid], epoch);
+	}
+	lfbst_delete_nodes(tree->root);
+	free(tree);
+}
+
+/**
+ * lfbst_delete_nodes - Deletes every node still linked in a lock-free
+ *	external BST.
+ *
+ * Description: Each left child is rotated up until the node has none,
+ *	then the node is freed and its right child is next, so the walk needs
+ *	no stack however deep the tree is.
+ *
+ * @node: Pointer to the root node of the subtree to delete.
+*/
+void lfbst_delete_nodes(lfbst_node_t *node)
+{
+	lfbst_node_t *next;
+
+	while (node)
+	{
+		next = LFBST_ADDR(node->left);
+		if (next)
+		{
+			node->left = next->right;
+			next->right = (uintptr_t)node;
+		}
+		else
+		{
+			next = LFBST_ADDR(node->right);
+			free(node);
+		}
+		node = next;
+	}
+}
@@ -0,0 +1,150 @@
+#include "binary_trees.h"
+
+void lfbst_seek(lfbst_t *tree, int value, lfbst_seek_t *record);
+int lfbst_goes_left(int value, const lfbst_node_t *node);
+void lfbst_epoch_enter(lfbst_t *tree, int tid);
+void lfbst_epoch_exit(lfbst_t *tree, int tid);
+int lfbst_cleanup(lfbst_t *tree, int value, lfbst_seek_t *record, int tid);
+void lfbst_retire_path(lfbst_t *tree, int value, lfbst_seek_t *record,
+	lfbst_node_t *kept, int tid);
+void lfbst_retire(lfbst_t *tree, lfbst_node_t *node, int tid);
+
+/**
+ * lfbst_remove - Removes a value from a lock-free external BST.
+ *
+ * Description: The edge to the leaf holding value is first flagged, which
+ *	decides the removal. The leaf and its parent are then unlinked by
+ *	moving the sibling of the leaf up, which any thread meeting the
+ *	flag may complete.
+ *
+ * @tree: Pointer to the tree to remove the value from.
+ * @value: Value to remove from the tree.
+ * @tid: Id of the calling thread, lower than LFBST_MAX_THREADS.
+ *
+ * Return: 1 if value is removed, 0 if it is not found or if tid is out
+ *	of range.
+*/
+int lfbst_remove(lfbst_t *tree, int value, int tid)
+{
+	lfbst_seek_t record;
+	lfbst_node_t *leaf = NULL;
+	uintptr_t *child, expected;
+
+	if (!tree || tid < 0 || tid >= LFBST_MAX_THREADS)
+		return (0);
+
+	lfbst_epoch_enter(tree, tid);
+	while (1)
+	{
+		lfbst_seek(tree, value, &record);
+		if (leaf && (record.leaf != leaf ||
+			lfbst_cleanup(tree, value, &record, tid)))
+			break;
+		if (leaf)
+			continue;
+
+		if (record.leaf->inf || record.leaf->n != value)
+			break;
+		child = lfbst_goes_left(value, record.parent) ?
+			&record.parent->left : &record.parent->right;
+		expected = (uintptr_t)record.leaf;
+		if (__atomic_compare_exchange_n(child, &expected,
+			expected | LFBST_FLAG, 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			leaf = record.leaf;
+			if (lfbst_cleanup(tree, value, &record, tid))
+				break;
+		}
+		else if (LFBST_ADDR(expected) == record.leaf &&
+			(expected & (LFBST_FLAG | LFBST_TAG)))
+			lfbst_cleanup(tree, value, &record, tid);
+	}
+	lfbst_epoch_exit(tree, tid);
+
+	return (leaf != NULL);
+}
+
+/**
+ * lfbst_cleanup - Unlinks a flagged leaf and its parent from a lock-free
+ *	external BST.
+ *
+ * Description: The edge to the node kept, the sibling of the flagged leaf,
+ *	is tagged so it can no longer change. The edge from ancestor to
+ *	successor is then swung to the kept node.
+ *
+ * @tree: Pointer to the tree.
+ * @value: Value whose path was recorded.
+ * @record: Pointer to the record of the path.
+ * @tid: Id of the calling thread.
+ *
+ * Return: 1 if this call unlinked the nodes, 0 otherwise.
+*/
+int lfbst_cleanup(lfbst_t *tree, int value, lfbst_seek_t *record, int tid)
+{
+	uintptr_t *successor, *child, *sibling, expected, kept;
+
+	successor = lfbst_goes_left(value, record->ancestor) ?
+		&record->ancestor->left : &record->ancestor->right;
+	if (lfbst_goes_left(value, record->parent))
+	{
+		child = &record->parent->left;
+		sibling = &record->parent->right;
+	}
+	else
+	{
+		child = &record->parent->right;
+		sibling = &record->parent->left;
+	}
+	if (!(__atomic_load_n(child, __ATOMIC_ACQUIRE) & LFBST_FLAG))
+		sibling = child;
+
+	kept = __atomic_or_fetch(sibling, LFBST_TAG, __ATOMIC_ACQ_REL);
+	kept &= ~(uintptr_t)LFBST_TAG;
+	expected = (uintptr_t)record->successor;
+	if (!__atomic_compare_exchange_n(successor, &expected, kept, 0,
+		__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		return (0);
+
+	lfbst_retire_path(tree, value, record, LFBST_ADDR(kept), tid);
+	return (1);
+}
+
+/**
+ * lfbst_retire_path - Retires the nodes unlinked by a cleanup.
+ *
+ * Description: Every internal node from successor down to parent is
+ *	unlinked, together with the flagged leaf hanging from each of them.
+ *
+ * @tree: Pointer to the tree.
+ * @value: Value whose path was recorded.
+ * @record: Pointer to the record of the path.
+ * @kept: Pointer to the node moved up in place of successor.
+ * @tid: Id of the calling thread.
+*/
+void lfbst_retire_path(lfbst_t *tree, int value, lfbst_seek_t *record,
+	lfbst_node_t *kept, int tid)
+{
+	lfbst_node_t *node = record->successor, *next, *other, *left, *right;
+
+	while (node)
+	{
+		left = LFBST_ADDR(__atomic_load_n(&node->left,
+			__ATOMIC_ACQUIRE));
+		right = LFBST_ADDR(__atomic_load_n(&node->right,
+			__ATOMIC_ACQUIRE));
+		next = lfbst_goes_left(value, node) ? left : right;
+		other = (next == left) ? right : left;
+		if (node == record->parent)
+		{
+			lfbst_retire(tree, (next == kept) ? other : next, tid);
+			next = NULL;
+		}
+		else
+		{
+			lfbst_retire(tree, other, tid);
+		}
+		lfbst_retire(tree, node, tid);
+		node = next;
+	}
+}
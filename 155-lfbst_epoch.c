@@ -0,0 +1,99 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+void lfbst_free_limbo(lfbst_epoch_t *thread, int epoch);
+
+/**
+ * lfbst_epoch_enter - Marks a thread as inside an operation on a lock-free
+ *	external BST.
+ *
+ * Description: A node retired while the global epoch is e may still be
+ *	read by threads that observed e - 1 or e, so it is freed once the
+ *	thread observes e + 2 or later.
+ *
+ * @tree: Pointer to the tree.
+ * @tid: Id of the calling thread.
+*/
+void lfbst_epoch_enter(lfbst_t *tree, int tid)
+{
+	lfbst_epoch_t *thread = &tree->threads[tid];
+	size_t epoch, last;
+
+	__atomic_store_n(&thread->active, 1, __ATOMIC_SEQ_CST);
+	epoch = __atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST);
+	last = thread->epoch;
+	if (epoch == last)
+		return;
+
+	lfbst_free_limbo(thread, (last + 2) % 3);
+	if (epoch - last >= 2)
+		lfbst_free_limbo(thread, last % 3);
+	if (epoch - last >= 3)
+		lfbst_free_limbo(thread, (last + 1) % 3);
+	__atomic_store_n(&thread->epoch, epoch, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * lfbst_epoch_exit - Marks a thread as outside any operation on a lock-free
+ *	external BST.
+ *
+ * @tree: Pointer to the tree.
+ * @tid: Id of the calling thread.
+*/
+void lfbst_epoch_exit(lfbst_t *tree, int tid)
+{
+	__atomic_store_n(&tree->threads[tid].active, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * lfbst_retire - Defers the freeing of a node unlinked from a lock-free
+ *	external BST until no thread can still be reading it.
+ *
+ * Description: Every 64 retired nodes, the global epoch is advanced if all
+ *	the threads inside an operation have observed the current one.
+ *
+ * @tree: Pointer to the tree.
+ * @node: Pointer to the unlinked node.
+ * @tid: Id of the calling thread.
+*/
+void lfbst_retire(lfbst_t *tree, lfbst_node_t *node, int tid)
+{
+	lfbst_epoch_t *thread = &tree->threads[tid];
+	lfbst_epoch_t *other;
+	size_t epoch;
+	int i;
+
+	epoch = __atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST);
+	node->retired = thread->limbo[epoch % 3];
+	thread->limbo[epoch % 3] = node;
+	if (++thread->count % 64)
+		return;
+
+	for (i = 0; i < LFBST_MAX_THREADS; i++)
+	{
+		other = &tree->threads[i];
+		if (__atomic_load_n(&other->active, __ATOMIC_SEQ_CST) &&
+			__atomic_load_n(&other->epoch, __ATOMIC_SEQ_CST) !=
+			epoch)
+			return;
+	}
+	__atomic_compare_exchange_n(&tree->epoch, &epoch, epoch + 1, 0,
+		__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * lfbst_free_limbo - Frees the nodes a thread retired in a given epoch.
+ *
+ * @thread: Pointer to the epoch state of the thread.
+ * @epoch: Epoch of retirement, modulo 3.
+*/
+void lfbst_free_limbo(lfbst_epoch_t *thread, int epoch)
+{
+	lfbst_node_t *node;
+
+	while ((node = thread->limbo[epoch]))
+	{
+		thread->limbo[epoch] = node->retired;
+		free(node);
+	}
+}
@@ -1,8 +1,6 @@
 #include "binary_trees.h"
 
-size_t max_depth(const binary_tree_t *tree);
-int check_is_full(const binary_tree_t *tree);
-int check_depth(const binary_tree_t *tree);
+size_t perfect_height(const binary_tree_t *tree);
 
 /**
  * binary_tree_is_perfect - Checks if a binary tree is perfect.
@@ -14,102 +12,58 @@ int check_depth(const binary_tree_t *tree);
 int binary_tree_is_perfect(const binary_tree_t *tree)
 {
 	if (!tree)
-	{
 		return (0);
-	}
-	else
-	{
-		return (check_is_full(tree) &&
-			check_depth(tree));
-	}
+
+	return (perfect_height(tree) != 0);
 }
 
 /**
- * check_depth - Checks the depth of all the subtrees.
+ * perfect_height - Measures the height of a perfect binary tree in a
+ *	single bottom-up pass.
+ *
+ * Description: A node is perfect when both its children are perfect
+ *	subtrees of the same height, so the walk stops at the first subtree
+ *	that is not.
  *
- * @tree: Pointer to the root node of the binary tree.
+ * @tree: Pointer to the root of the binary tree, not NULL.
  *
- * Return: 1 if all depths are equal, 0 if otherwise.
- */
-int check_depth(const binary_tree_t *tree)
+ * Return: Height counted in nodes if tree is perfect, 0 otherwise.
+*/
+size_t perfect_height(const binary_tree_t *tree)
 {
-	int depth;
+	size_t left_height, right_height;
 
-	if (!tree || (!tree->left && !tree->right))
-	{
+	if (!tree->left && !tree->right)
 		return (1);
-	}
-	else if ((tree->left && !tree->right) || (!tree->left && tree->right))
-	{
+	if (!tree->left || !tree->right)
 		return (0);
-	}
-	else
-	{
-		depth = (max_depth(tree->left) == max_depth(tree->right));
-		if (!depth)
-			return (0);
-		if (!check_depth(tree->left))
-			return (0);
-		if (!check_depth(tree->right))
-			return (0);
-		return (1);
-	}
-}
-/**
- * max_depth - Find the max depth of a binary tree.
- *
- * @tree: Pointer to the root of the binary tree.
- *
- * Return: Max depth of the binary tree.
-*/
-size_t max_depth(const binary_tree_t *tree)
-{
-	size_t right_depth, left_depth;
 
-	if (!tree)
-	{
+	left_height = perfect_height(tree->left);
+	if (!left_height)
+		return (0);
+	right_height = perfect_height(tree->right);
+	if (left_height != right_height)
 		return (0);
-	}
-	else
-	{
-		left_depth = max_depth(tree->left);
-		right_depth = max_depth(tree->right);
 
-		if (left_depth > right_depth)
-			return (left_depth + 1);
-		else
-			return (right_depth + 1);
-	}
+	return (left_height + 1);
 }
 
 /**
- * check_is_full - Checks if a binary tree is full.
+ * binary_tree_is_perfect_size - Checks if a binary tree is perfect from
+ *	its height and size, in O(1).
  *
- * @tree: Pointer to the root of the binary tree.
+ * Description: For trees whose nodes keep their height and subtree size,
+ *	a tree of height h is perfect exactly when it holds 2^h - 1 nodes.
+ *
+ * @height: Height of the tree counted in nodes, 0 for an empty tree.
+ * @size: Number of nodes in the tree.
  *
- * Return: 1 if is full, or 0 if otherwise.
+ * Return: 1 if is perfect, 0 if otherwise.
 */
-int check_is_full(const binary_tree_t *tree)
+int binary_tree_is_perfect_size(size_t height, size_t size)
 {
-	int right_leaves, left_leaves;
-
-	if (!tree || (!tree->left && tree->right) ||
-		(tree->left && !tree->right))
-	{
+	if (!height || height > sizeof(size) * 8)
 		return (0);
-	}
-	else if (!tree->left && !tree->right)
-	{
-		return (1);
-	}
-	else
-	{
-		left_leaves = check_is_full(tree->left);
-		if (!left_leaves && tree->left)
-			return (0);
-
-		right_leaves = check_is_full(tree->right);
 
-		return ((left_leaves + right_leaves + 1) % 2);
-	}
+	return (size == ((size_t)1 << (height - 1)) * 2 - 1);
 }
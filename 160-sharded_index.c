@@ -0,0 +1,133 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+size_t shard_of(const sharded_index_t *index, int value);
+
+/**
+ * sharded_index_create - Creates an empty sharded index.
+ *
+ * @count: Number of AVL trees to spread the values over.
+ *
+ * Return: Pointer to the new index, or NULL on failure or if count is 0.
+*/
+sharded_index_t *sharded_index_create(size_t count)
+{
+	sharded_index_t *index;
+	size_t i;
+
+	if (!count)
+		return (NULL);
+
+	index = malloc(sizeof(sharded_index_t));
+	if (!index)
+		return (NULL);
+
+	index->shards = malloc(sizeof(shard_t) * count);
+	if (!index->shards)
+	{
+		free(index);
+		return (NULL);
+	}
+	index->count = count;
+	for (i = 0; i < count; i++)
+	{
+		index->shards[i].root = NULL;
+		pthread_mutex_init(&index->shards[i].lock, NULL);
+	}
+
+	return (index);
+}
+
+/**
+ * sharded_index_delete - Deletes a sharded index.
+ *
+ * Description: No other thread may use the index while it is deleted.
+ *
+ * @index: Pointer to the index to delete.
+*/
+void sharded_index_delete(sharded_index_t *index)
+{
+	size_t i;
+
+	if (!index)
+		return;
+
+	for (i = 0; i < index->count; i++)
+	{
+		binary_tree_delete(index->shards[i].root);
+		pthread_mutex_destroy(&index->shards[i].lock);
+	}
+	free(index->shards);
+	free(index);
+}
+
+/**
+ * sharded_index_insert - Inserts a value in a sharded index.
+ *
+ * Description: Only the shard the value hashes to is locked, so threads
+ *	inserting in different shards do not wait for each other.
+ *
+ * @index: Pointer to the index to insert the value in.
+ * @value: Value to insert.
+ *
+ * Return: 1 if value is inserted, 0 if it already exists or on failure.
+*/
+int sharded_index_insert(sharded_index_t *index, int value)
+{
+	shard_t *shard;
+	int inserted;
+
+	if (!index)
+		return (0);
+
+	shard = &index->shards[shard_of(index, value)];
+	pthread_mutex_lock(&shard->lock);
+	inserted = (avl_insert(&shard->root, value) != NULL);
+	pthread_mutex_unlock(&shard->lock);
+
+	return (inserted);
+}
+
+/**
+ * sharded_index_search - Searches for a value in a sharded index.
+ *
+ * @index: Pointer to the index to search.
+ * @value: Value to search.
+ *
+ * Return: 1 if value is found, 0 otherwise.
+*/
+int sharded_index_search(sharded_index_t *index, int value)
+{
+	shard_t *shard;
+	const avl_t *node;
+
+	if (!index)
+		return (0);
+
+	shard = &index->shards[shard_of(index, value)];
+	pthread_mutex_lock(&shard->lock);
+	node = shard->root;
+	while (node && node->n != value)
+		node = (value < node->n) ? node->left : node->right;
+	pthread_mutex_unlock(&shard->lock);
+
+	return (node != NULL);
+}
+
+/**
+ * shard_of - Gets the shard a value belongs to.
+ *
+ * Description: Values are spread with a multiplicative hash, so runs of
+ *	close values are split across every shard.
+ *
+ * @index: Pointer to the index.
+ * @value: Value to hash.
+ *
+ * Return: Index of the shard.
+*/
+size_t shard_of(const sharded_index_t *index, int value)
+{
+	unsigned int hash = (unsigned int)value * 2654435761U;
+
+	return ((hash ^ (hash >> 16)) % index->count);
+}
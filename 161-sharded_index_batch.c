@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+size_t shard_of(const sharded_index_t *index, int value);
+size_t shard_insert_group(shard_t *shard, int *group, size_t size);
+int compare_ints(const void *a, const void *b);
+
+/**
+ * sharded_index_insert_batch - Inserts an array of values in a sharded index.
+ *
+ * Description: The values are first grouped by shard, so each shard is
+ *	locked once for the whole batch instead of once per value.
+ *
+ * @index: Pointer to the index to insert the values in.
+ * @values: Pointer to the first element of the array of values.
+ * @size: Number of elements in the array.
+ *
+ * Return: Number of values inserted.
+*/
+size_t sharded_index_insert_batch(sharded_index_t *index, int *values,
+	size_t size)
+{
+	size_t *starts, *shards, i, inserted = 0;
+	int *groups;
+
+	if (!index || !values || !size)
+		return (0);
+
+	starts = calloc(index->count + 1, sizeof(*starts));
+	shards = malloc(sizeof(*shards) * size);
+	groups = malloc(sizeof(*groups) * size);
+	if (starts && shards && groups)
+	{
+		for (i = 0; i < size; i++)
+		{
+			shards[i] = shard_of(index, values[i]);
+			starts[shards[i] + 1]++;
+		}
+		for (i = 0; i < index->count; i++)
+			starts[i + 1] += starts[i];
+		for (i = 0; i < size; i++)
+			groups[starts[shards[i]]++] = values[i];
+
+		for (i = index->count; i > 0; i--)
+			starts[i] = starts[i - 1];
+		for (starts[0] = 0, i = 0; i < index->count; i++)
+			inserted += shard_insert_group(&index->shards[i],
+				groups + starts[i], starts[i + 1] - starts[i]);
+	}
+	free(starts);
+	free(shards);
+	free(groups);
+
+	return (inserted);
+}
+
+/**
+ * shard_insert_group - Inserts the values of a batch that belong to a shard.
+ *
+ * Description: An empty shard is built at once from the sorted values with
+ *	sorted_array_to_avl, otherwise they are inserted one by one.
+ *
+ * @shard: Pointer to the shard.
+ * @group: Pointer to the values belonging to the shard, reordered in place.
+ * @size: Number of values.
+ *
+ * Return: Number of values inserted.
+*/
+size_t shard_insert_group(shard_t *shard, int *group, size_t size)
+{
+	size_t i, unique, inserted = 0;
+
+	if (!size)
+		return (0);
+
+	pthread_mutex_lock(&shard->lock);
+	if (!shard->root)
+	{
+		qsort(group, size, sizeof(*group), &compare_ints);
+		for (unique = 1, i = 1; i < size; i++)
+		{
+			if (group[i] != group[unique - 1])
+				group[unique++] = group[i];
+		}
+		shard->root = sorted_array_to_avl(group, unique);
+		inserted = shard->root ? unique : 0;
+	}
+	else
+	{
+		for (i = 0; i < size; i++)
+		{
+			if (avl_insert(&shard->root, group[i]))
+				inserted++;
+		}
+	}
+	pthread_mutex_unlock(&shard->lock);
+
+	return (inserted);
+}
+
+/**
+ * compare_ints - Compares two integers for qsort.
+ *
+ * @a: Pointer to the first integer.
+ * @b: Pointer to the second integer.
+ *
+ * Return: Negative, zero or positive if a is lower, equal or greater than b.
+*/
+int compare_ints(const void *a, const void *b)
+{
+	int first = *(const int *)a, second = *(const int *)b;
+
+	return ((first > second) - (first < second));
+}
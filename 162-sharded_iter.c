@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+int shard_copy(const avl_t *node, int **values, size_t *size,
+	size_t *capacity);
+void shard_sift(sharded_iter_t *iter, size_t index);
+
+/**
+ * sharded_iter_init - Starts an in-order iteration over a sharded index.
+ *
+ * Description: Each shard is locked only while its values are copied, in
+ *	order, so writers wait for one shard at a time instead of the whole
+ *	iteration. Each shard is seen as it was when copied, values inserted
+ *	in a shard after that being missed. The next value of each shard is
+ *	kept in a small min heap, so each step is in O(log(count)) for count
+ *	shards.
+ *
+ * @iter: Pointer to the iterator to initialize.
+ * @index: Pointer to the index to iterate.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int sharded_iter_init(sharded_iter_t *iter, sharded_index_t *index)
+{
+	size_t i, size = 0, capacity = 0;
+	int copied = 1;
+
+	if (!iter || !index)
+		return (0);
+
+	iter->values = NULL;
+	iter->count = 0;
+	iter->next = malloc(sizeof(*iter->next) * index->count * 3);
+	if (!iter->next)
+		return (0);
+	iter->ends = iter->next + index->count;
+	iter->heap = iter->ends + index->count;
+	for (i = 0; i < index->count && copied; i++)
+	{
+		iter->next[i] = size;
+		pthread_mutex_lock(&index->shards[i].lock);
+		copied = shard_copy(index->shards[i].root, &iter->values, &size,
+			&capacity);
+		pthread_mutex_unlock(&index->shards[i].lock);
+		iter->ends[i] = size;
+		if (size > iter->next[i])
+			iter->heap[iter->count++] = i;
+	}
+	if (!copied)
+	{
+		sharded_iter_end(iter);
+		return (0);
+	}
+	for (i = iter->count / 2; i > 0; i--)
+		shard_sift(iter, i - 1);
+
+	return (1);
+}
+
+/**
+ * sharded_iter_next - Gets the next value of an in-order iteration.
+ *
+ * Description: The lowest of the next values of every shard, at the top
+ *	of the heap, is returned, merging the shards into one ordered
+ *	sequence.
+ *
+ * @iter: Pointer to the iterator.
+ * @value: Pointer to where the value is stored.
+ *
+ * Return: 1 if a value is stored, 0 once every value has been visited.
+*/
+int sharded_iter_next(sharded_iter_t *iter, int *value)
+{
+	size_t shard;
+
+	if (!iter->count)
+		return (0);
+
+	shard = iter->heap[0];
+	*value = iter->values[iter->next[shard]++];
+	if (iter->next[shard] == iter->ends[shard])
+		iter->heap[0] = iter->heap[--iter->count];
+	if (iter->count)
+		shard_sift(iter, 0);
+
+	return (1);
+}
+
+/**
+ * sharded_iter_end - Ends an iteration and releases its copy of the
+ *	values.
+ *
+ * @iter: Pointer to the iterator.
+*/
+void sharded_iter_end(sharded_iter_t *iter)
+{
+	free(iter->values);
+	free(iter->next);
+	iter->values = NULL;
+	iter->next = NULL;
+	iter->count = 0;
+}
+
+/**
+ * shard_copy - Appends the values of an AVL tree, in order, to an array.
+ *
+ * @node: Pointer to the root node of the tree.
+ * @values: Pointer to the array, grown as needed.
+ * @size: Pointer to the number of values in the array.
+ * @capacity: Pointer to the number of values the array can hold.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int shard_copy(const avl_t *node, int **values, size_t *size,
+	size_t *capacity)
+{
+	int *grown;
+
+	while (node && node->left)
+		node = node->left;
+	while (node)
+	{
+		if (*size == *capacity)
+		{
+			grown = realloc(*values, sizeof(**values) *
+				(*capacity ? *capacity * 2 : 64));
+			if (!grown)
+				return (0);
+			*values = grown;
+			*capacity = *capacity ? *capacity * 2 : 64;
+		}
+		(*values)[(*size)++] = node->n;
+		if (node->right)
+			for (node = node->right; node->left; node = node->left)
+				;
+		else
+		{
+			while (node->parent && node->parent->right == node)
+				node = node->parent;
+			node = node->parent;
+		}
+	}
+
+	return (1);
+}
+
+/**
+ * shard_sift - Moves a shard down the heap of an iterator to its place.
+ *
+ * @iter: Pointer to the iterator.
+ * @index: Index in the heap of the shard to move.
+*/
+void shard_sift(sharded_iter_t *iter, size_t index)
+{
+	size_t child, shard = iter->heap[index];
+	int value = iter->values[iter->next[shard]];
+
+	while ((child = 2 * index + 1) < iter->count)
+	{
+		if (child + 1 < iter->count &&
+			iter->values[iter->next[iter->heap[child + 1]]] <
+			iter->values[iter->next[iter->heap[child]]])
+			child++;
+		if (iter->values[iter->next[iter->heap[child]]] >= value)
+			break;
+		iter->heap[index] = iter->heap[child];
+		index = child;
+	}
+	iter->heap[index] = shard;
+}
@@ -0,0 +1,134 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+int mq_push(mq_heap_t *heap, int value);
+
+/**
+ * multiqueue_create - Creates an empty multiqueue.
+ *
+ * @count: Number of heaps, usually a small multiple of the number of
+ *	threads using the queue.
+ *
+ * Return: Pointer to the new multiqueue, or NULL on failure or if count
+ *	is lower than 2.
+*/
+multiqueue_t *multiqueue_create(size_t count)
+{
+	multiqueue_t *mq;
+	size_t i;
+
+	if (count < 2)
+		return (NULL);
+
+	mq = malloc(sizeof(multiqueue_t));
+	if (!mq)
+		return (NULL);
+
+	if (posix_memalign((void **)&mq->heaps, BT_CACHE_LINE,
+		sizeof(mq_heap_t) * count))
+	{
+		free(mq);
+		return (NULL);
+	}
+	mq->count = count;
+	for (i = 0; i < count; i++)
+	{
+		mq->heaps[i].data = NULL;
+		mq->heaps[i].size = 0;
+		mq->heaps[i].capacity = 0;
+		mq->heaps[i].top = 0;
+		pthread_mutex_init(&mq->heaps[i].lock, NULL);
+	}
+
+	return (mq);
+}
+
+/**
+ * multiqueue_delete - Deletes a multiqueue.
+ *
+ * Description: No other thread may use the queue while it is deleted.
+ *
+ * @mq: Pointer to the multiqueue to delete.
+*/
+void multiqueue_delete(multiqueue_t *mq)
+{
+	size_t i;
+
+	if (!mq)
+		return;
+
+	for (i = 0; i < mq->count; i++)
+	{
+		free(mq->heaps[i].data);
+		pthread_mutex_destroy(&mq->heaps[i].lock);
+	}
+	free(mq->heaps);
+	free(mq);
+}
+
+/**
+ * multiqueue_insert - Inserts a value in a multiqueue.
+ *
+ * Description: The value goes to a random heap whose lock is free, so
+ *	concurrent producers rarely wait for each other.
+ *
+ * @mq: Pointer to the multiqueue.
+ * @value: Value to insert.
+ * @seed: Pointer to the random seed of the calling thread.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int multiqueue_insert(multiqueue_t *mq, int value, unsigned int *seed)
+{
+	mq_heap_t *heap;
+	int inserted;
+
+	if (!mq || !seed)
+		return (0);
+
+	do {
+		heap = &mq->heaps[rand_r(seed) % mq->count];
+	} while (pthread_mutex_trylock(&heap->lock));
+
+	inserted = mq_push(heap, value);
+	pthread_mutex_unlock(&heap->lock);
+
+	return (inserted);
+}
+
+/**
+ * mq_push - Pushes a value on a locked heap of a multiqueue.
+ *
+ * @heap: Pointer to the heap.
+ * @value: Value to push.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int mq_push(mq_heap_t *heap, int value)
+{
+	size_t index, parent;
+	int *data;
+
+	if (heap->size == heap->capacity)
+	{
+		data = realloc(heap->data, sizeof(*data) *
+			(heap->capacity ? heap->capacity * 2 : 64));
+		if (!data)
+			return (0);
+		heap->data = data;
+		heap->capacity = heap->capacity ? heap->capacity * 2 : 64;
+	}
+
+	for (index = heap->size; index; index = parent)
+	{
+		parent = (index - 1) / 2;
+		if (heap->data[parent] >= value)
+			break;
+		heap->data[index] = heap->data[parent];
+	}
+	heap->data[index] = value;
+
+	__atomic_store_n(&heap->top, heap->data[0], __ATOMIC_RELAXED);
+	__atomic_store_n(&heap->size, heap->size + 1, __ATOMIC_RELEASE);
+	return (1);
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+mq_heap_t *mq_pick(multiqueue_t *mq, unsigned int *seed);
+void mq_pop(mq_heap_t *heap, int *value);
+
+/**
+ * multiqueue_extract - Extracts a large value from a multiqueue.
+ *
+ * Description: The value extracted is the top of the better of two random
+ *	heaps, so it is close to, but not always, the largest value of the
+ *	queue. If both heaps are empty, every heap is tried in turn.
+ *
+ * @mq: Pointer to the multiqueue.
+ * @value: Pointer to where the extracted value is stored.
+ * @seed: Pointer to the random seed of the calling thread.
+ *
+ * Return: 1 if a value is extracted, 0 if the queue is empty.
+*/
+int multiqueue_extract(multiqueue_t *mq, int *value, unsigned int *seed)
+{
+	mq_heap_t *heap;
+	size_t i;
+
+	if (!mq || !value || !seed)
+		return (0);
+
+	heap = mq_pick(mq, seed);
+	if (heap)
+	{
+		pthread_mutex_lock(&heap->lock);
+		if (heap->size)
+		{
+			mq_pop(heap, value);
+			pthread_mutex_unlock(&heap->lock);
+			return (1);
+		}
+		pthread_mutex_unlock(&heap->lock);
+	}
+
+	for (i = 0; i < mq->count; i++)
+	{
+		heap = &mq->heaps[i];
+		pthread_mutex_lock(&heap->lock);
+		if (heap->size)
+		{
+			mq_pop(heap, value);
+			pthread_mutex_unlock(&heap->lock);
+			return (1);
+		}
+		pthread_mutex_unlock(&heap->lock);
+	}
+	return (0);
+}
+
+/**
+ * mq_pick - Picks the heap with the larger top out of two random heaps.
+ *
+ * Description: Sizes and tops are read without locking, so the choice is
+ *	only a hint that the caller checks once the heap is locked.
+ *
+ * @mq: Pointer to the multiqueue.
+ * @seed: Pointer to the random seed of the calling thread.
+ *
+ * Return: Pointer to the heap picked, or NULL if both heaps look empty.
+*/
+mq_heap_t *mq_pick(multiqueue_t *mq, unsigned int *seed)
+{
+	mq_heap_t *first, *second;
+	size_t i, j;
+
+	i = rand_r(seed) % mq->count;
+	j = rand_r(seed) % (mq->count - 1);
+
+	first = &mq->heaps[i];
+	second = &mq->heaps[j < i ? j : j + 1];
+
+	if (!__atomic_load_n(&first->size, __ATOMIC_ACQUIRE))
+		first = NULL;
+	if (!__atomic_load_n(&second->size, __ATOMIC_ACQUIRE))
+		return (first);
+	if (!first || __atomic_load_n(&second->top, __ATOMIC_RELAXED) >
+		__atomic_load_n(&first->top, __ATOMIC_RELAXED))
+		return (second);
+
+	return (first);
+}
+
+/**
+ * mq_pop - Pops the top of a locked, non empty heap of a multiqueue.
+ *
+ * @heap: Pointer to the heap.
+ * @value: Pointer to where the value popped is stored.
+*/
+void mq_pop(mq_heap_t *heap, int *value)
+{
+	size_t index = 0, child, size = heap->size - 1;
+	int last = heap->data[size];
+
+	*value = heap->data[0];
+	while ((child = 2 * index + 1) < size)
+	{
+		if (child + 1 < size &&
+			heap->data[child + 1] > heap->data[child])
+			child++;
+		if (heap->data[child] <= last)
+			break;
+		heap->data[index] = heap->data[child];
+		index = child;
+	}
+	heap->data[index] = last;
+
+	__atomic_store_n(&heap->top, heap->data[0], __ATOMIC_RELAXED);
+	__atomic_store_n(&heap->size, size, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,202 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+int reduce_split(reduce_job_t *job, const binary_tree_t *tree,
+	size_t target, void *result);
+void *reduce_worker(void *arg);
+int reduce_subtree(const tree_reducer_t *reducer, reduce_task_t task,
+	void *acc);
+int reduce_push(reduce_task_t **tasks, size_t *count, size_t *capacity,
+	const binary_tree_t *node, size_t depth);
+
+/**
+ * binary_tree_parallel_reduce - Folds a reduction over every node of a
+ *	binary tree using several threads.
+ *
+ * Description: The top of the tree is reduced by the calling thread until
+ *	enough disjoint subtrees are found. Those are then shared out between
+ *	the workers, each folding into its own accumulator, and the
+ *	accumulators are merged into result. Each accumulator starts on its
+ *	own cache line, so workers do not invalidate each other's caches.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @reducer: Pointer to the reduction.
+ * @threads: Number of threads to use, including the calling one.
+ * @result: Pointer to the accumulator where the result is stored.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int binary_tree_parallel_reduce(const binary_tree_t *tree,
+	const tree_reducer_t *reducer, size_t threads, void *result)
+{
+	reduce_job_t job = {NULL, NULL, 0, 0, 0, NULL, 0, 0};
+	pthread_t *workers;
+	size_t i, started = 0;
+
+	if (!reducer || !result)
+		return (0);
+	reducer->init(result, reducer->arg);
+	if (!tree)
+		return (1);
+
+	job.reducer = reducer;
+	threads = threads ? threads : 1;
+	workers = malloc(sizeof(*workers) * threads);
+	job.stride = (reducer->size + BT_CACHE_LINE - 1) / BT_CACHE_LINE *
+		BT_CACHE_LINE;
+	job.failed = !workers || posix_memalign((void **)&job.accs,
+		BT_CACHE_LINE, job.stride * threads) ||
+		!reduce_split(&job, tree, threads * 8, result);
+	if (job.failed)
+		threads = 0;
+	for (i = 0; i < threads; i++)
+		reducer->init(job.accs + i * job.stride, reducer->arg);
+	while (started + 1 < threads &&
+		!pthread_create(&workers[started], NULL, &reduce_worker, &job))
+		started++;
+	if (threads)
+		reduce_worker(&job);
+	for (i = 0; i < started; i++)
+		pthread_join(workers[i], NULL);
+	for (i = 0; i < threads && i <= started; i++)
+		reducer->merge(result, job.accs + i * job.stride,
+			reducer->arg);
+	free(workers);
+	free(job.accs);
+	free(job.tasks);
+
+	return (!job.failed);
+}
+
+/**
+ * reduce_split - Reduces the top of a tree breadth first until the
+ *	subtrees left are numerous enough to keep the workers busy.
+ *
+ * Description: The number of nodes reduced this way is bounded, so a
+ *	degenerate tree does not end up reduced by a single thread here.
+ *
+ * @job: Pointer to the job where the remaining subtrees are stored.
+ * @tree: Pointer to the root node of the tree.
+ * @target: Number of subtrees wanted.
+ * @result: Pointer to the accumulator of the calling thread.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int reduce_split(reduce_job_t *job, const binary_tree_t *tree,
+	size_t target, void *result)
+{
+	const tree_reducer_t *reducer = job->reducer;
+	size_t head = 0, capacity = 0;
+	reduce_task_t task;
+
+	reduce_task_t **tasks = &job->tasks;
+	int success = reduce_push(tasks, &job->count, &capacity, tree, 0);
+
+	while (success && head < job->count && job->count - head < target &&
+		head < target * 4)
+	{
+		task = (*tasks)[head++];
+		reducer->visit(result, task.node, task.depth, reducer->arg);
+		if (task.node->left)
+			success = reduce_push(tasks, &job->count, &capacity,
+				task.node->left, task.depth + 1);
+		if (success && task.node->right)
+			success = reduce_push(tasks, &job->count, &capacity,
+				task.node->right, task.depth + 1);
+	}
+	job->next = head;
+
+	return (success);
+}
+
+/**
+ * reduce_worker - Reduces subtrees of a parallel reduction until none is
+ *	left.
+ *
+ * @arg: Pointer to the job.
+ *
+ * Return: NULL.
+*/
+void *reduce_worker(void *arg)
+{
+	reduce_job_t *job = arg;
+	size_t id, task;
+	void *acc;
+
+	id = __atomic_fetch_add(&job->workers, 1, __ATOMIC_RELAXED);
+	acc = job->accs + id * job->stride;
+
+	while ((task = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) <
+		job->count)
+	{
+		if (!reduce_subtree(job->reducer, job->tasks[task], acc))
+			__atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+	}
+
+	return (NULL);
+}
+
+/**
+ * reduce_subtree - Folds a reduction over every node of a subtree, depth
+ *	first, with an explicit stack.
+ *
+ * @reducer: Pointer to the reduction.
+ * @task: Subtree to reduce.
+ * @acc: Pointer to the accumulator to fold into.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int reduce_subtree(const tree_reducer_t *reducer, reduce_task_t task,
+	void *acc)
+{
+	reduce_task_t *stack = NULL;
+	size_t count = 0, capacity = 0;
+	int success = reduce_push(&stack, &count, &capacity, task.node,
+		task.depth);
+
+	while (success && count)
+	{
+		task = stack[--count];
+		reducer->visit(acc, task.node, task.depth, reducer->arg);
+		if (task.node->right)
+			success = reduce_push(&stack, &count, &capacity,
+				task.node->right, task.depth + 1);
+		if (success && task.node->left)
+			success = reduce_push(&stack, &count, &capacity,
+				task.node->left, task.depth + 1);
+	}
+	free(stack);
+
+	return (success);
+}
+
+/**
+ * reduce_push - Appends a subtree to a growable array of tasks.
+ *
+ * @tasks: Double pointer to the array.
+ * @count: Pointer to the number of tasks in the array.
+ * @capacity: Pointer to the number of tasks the array can hold.
+ * @node: Pointer to the root node of the subtree.
+ * @depth: Depth of node in the whole tree.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int reduce_push(reduce_task_t **tasks, size_t *count, size_t *capacity,
+	const binary_tree_t *node, size_t depth)
+{
+	reduce_task_t *grown;
+
+	if (*count == *capacity)
+	{
+		grown = realloc(*tasks, sizeof(**tasks) *
+			(*capacity ? *capacity * 2 : 64));
+		if (!grown)
+			return (0);
+		*tasks = grown;
+		*capacity = *capacity ? *capacity * 2 : 64;
+	}
+	(*tasks)[*count].node = node;
+	(*tasks)[(*count)++].depth = depth;
+
+	return (1);
+}
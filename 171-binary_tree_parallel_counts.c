@@ -0,0 +1,86 @@
+#include <string.h>
+#include "binary_trees.h"
+
+void counts_init(void *acc, void *arg);
+void counts_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg);
+void counts_merge(void *acc, const void *other, void *arg);
+
+/**
+ * binary_tree_parallel_counts - Counts the nodes, leaves and inner nodes
+ *	and measures the height of a binary tree using several threads.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @threads: Number of threads to use.
+ * @counts: Pointer to where the counts are stored.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int binary_tree_parallel_counts(const binary_tree_t *tree, size_t threads,
+	tree_counts_t *counts)
+{
+	tree_reducer_t reducer;
+
+	reducer.size = sizeof(*counts);
+	reducer.init = &counts_init;
+	reducer.visit = &counts_visit;
+	reducer.merge = &counts_merge;
+	reducer.arg = NULL;
+
+	return (binary_tree_parallel_reduce(tree, &reducer, threads, counts));
+}
+
+/**
+ * counts_init - Sets shape counts to those of an empty tree.
+ *
+ * @acc: Pointer to the counts.
+ * @arg: Unused.
+*/
+void counts_init(void *acc, void *arg)
+{
+	(void)arg;
+	memset(acc, 0, sizeof(tree_counts_t));
+}
+
+/**
+ * counts_visit - Adds a node to shape counts.
+ *
+ * @acc: Pointer to the counts.
+ * @node: Pointer to the node.
+ * @depth: Depth of the node, the height of a tree being its deepest depth.
+ * @arg: Unused.
+*/
+void counts_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg)
+{
+	tree_counts_t *counts = acc;
+
+	(void)arg;
+	counts->size++;
+	if (node->left || node->right)
+		counts->nodes++;
+	else
+		counts->leaves++;
+	if (depth > counts->height)
+		counts->height = depth;
+}
+
+/**
+ * counts_merge - Adds shape counts of disjoint subtrees together.
+ *
+ * @acc: Pointer to the counts to add to.
+ * @other: Pointer to the counts to add.
+ * @arg: Unused.
+*/
+void counts_merge(void *acc, const void *other, void *arg)
+{
+	tree_counts_t *counts = acc;
+	const tree_counts_t *more = other;
+
+	(void)arg;
+	counts->size += more->size;
+	counts->leaves += more->leaves;
+	counts->nodes += more->nodes;
+	if (more->height > counts->height)
+		counts->height = more->height;
+}
@@ -0,0 +1,93 @@
+#include "binary_trees.h"
+
+void values_init(void *acc, void *arg);
+void values_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg);
+void values_merge(void *acc, const void *other, void *arg);
+
+/**
+ * binary_tree_parallel_values - Computes the count, sum, lowest and
+ *	greatest value of a binary tree using several threads.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @threads: Number of threads to use.
+ * @values: Pointer to where the statistics are stored.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int binary_tree_parallel_values(const binary_tree_t *tree, size_t threads,
+	tree_values_t *values)
+{
+	tree_reducer_t reducer;
+
+	reducer.size = sizeof(*values);
+	reducer.init = &values_init;
+	reducer.visit = &values_visit;
+	reducer.merge = &values_merge;
+	reducer.arg = NULL;
+
+	return (binary_tree_parallel_reduce(tree, &reducer, threads, values));
+}
+
+/**
+ * values_init - Sets statistics to those of an empty tree.
+ *
+ * @acc: Pointer to the statistics.
+ * @arg: Unused.
+*/
+void values_init(void *acc, void *arg)
+{
+	tree_values_t *values = acc;
+
+	(void)arg;
+	values->count = 0;
+	values->sum = 0;
+	values->min = 0;
+	values->max = 0;
+}
+
+/**
+ * values_visit - Adds the value of a node to statistics.
+ *
+ * @acc: Pointer to the statistics.
+ * @node: Pointer to the node.
+ * @depth: Unused.
+ * @arg: Unused.
+*/
+void values_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg)
+{
+	tree_values_t *values = acc;
+
+	(void)depth;
+	(void)arg;
+	if (!values->count || node->n < values->min)
+		values->min = node->n;
+	if (!values->count || node->n > values->max)
+		values->max = node->n;
+	values->sum += node->n;
+	values->count++;
+}
+
+/**
+ * values_merge - Adds statistics of disjoint subtrees together.
+ *
+ * @acc: Pointer to the statistics to add to.
+ * @other: Pointer to the statistics to add.
+ * @arg: Unused.
+*/
+void values_merge(void *acc, const void *other, void *arg)
+{
+	tree_values_t *values = acc;
+	const tree_values_t *more = other;
+
+	(void)arg;
+	if (!more->count)
+		return;
+	if (!values->count || more->min < values->min)
+		values->min = more->min;
+	if (!values->count || more->max > values->max)
+		values->max = more->max;
+	values->sum += more->sum;
+	values->count += more->count;
+}
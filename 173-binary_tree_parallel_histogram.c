@@ -0,0 +1,89 @@
+#include <string.h>
+#include "binary_trees.h"
+
+void histogram_init(void *acc, void *arg);
+void histogram_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg);
+void histogram_merge(void *acc, const void *other, void *arg);
+
+/**
+ * binary_tree_parallel_histogram - Counts the values of a binary tree
+ *	falling in each bin of a histogram using several threads.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @threads: Number of threads to use.
+ * @histogram: Pointer to the histogram, whose bins are overwritten.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int binary_tree_parallel_histogram(const binary_tree_t *tree, size_t threads,
+	tree_histogram_t *histogram)
+{
+	tree_reducer_t reducer;
+
+	if (!histogram || !histogram->bins || !histogram->count ||
+		histogram->width < 1)
+		return (0);
+
+	reducer.size = sizeof(*histogram->bins) * histogram->count;
+	reducer.init = &histogram_init;
+	reducer.visit = &histogram_visit;
+	reducer.merge = &histogram_merge;
+	reducer.arg = histogram;
+
+	return (binary_tree_parallel_reduce(tree, &reducer, threads,
+		histogram->bins));
+}
+
+/**
+ * histogram_init - Empties the bins of a histogram.
+ *
+ * @acc: Pointer to the bins.
+ * @arg: Pointer to the histogram.
+*/
+void histogram_init(void *acc, void *arg)
+{
+	tree_histogram_t *histogram = arg;
+
+	memset(acc, 0, sizeof(*histogram->bins) * histogram->count);
+}
+
+/**
+ * histogram_visit - Counts the value of a node in its bin.
+ *
+ * @acc: Pointer to the bins.
+ * @node: Pointer to the node.
+ * @depth: Unused.
+ * @arg: Pointer to the histogram.
+*/
+void histogram_visit(void *acc, const binary_tree_t *node, size_t depth,
+	void *arg)
+{
+	tree_histogram_t *histogram = arg;
+	size_t *bins = acc, bin = 0;
+	long offset = (long)node->n - histogram->lo;
+
+	(void)depth;
+	if (offset > 0)
+		bin = offset / histogram->width;
+	if (bin >= histogram->count)
+		bin = histogram->count - 1;
+	bins[bin]++;
+}
+
+/**
+ * histogram_merge - Adds the bins of disjoint subtrees together.
+ *
+ * @acc: Pointer to the bins to add to.
+ * @other: Pointer to the bins to add.
+ * @arg: Pointer to the histogram.
+*/
+void histogram_merge(void *acc, const void *other, void *arg)
+{
+	tree_histogram_t *histogram = arg;
+	const size_t *more = other;
+	size_t *bins = acc, i;
+
+	for (i = 0; i < histogram->count; i++)
+		bins[i] += more[i];
+}
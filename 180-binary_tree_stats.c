@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+size_t stats_walk(tree_stats_t *stats, const binary_tree_t *tree,
+	int *success);
+int stats_visit(tree_stats_t *stats, const binary_tree_t *node,
+	size_t depth);
+int reduce_push(reduce_task_t **tasks, size_t *count, size_t *capacity,
+	const binary_tree_t *node, size_t depth);
+
+/**
+ * binary_tree_stats - Computes the shape statistics of a binary tree in a
+ *	single traversal.
+ *
+ * Description: Every statistic matches the function it is named after,
+ *	including their values for a NULL tree. The depth histograms are
+ *	allocated and must be released with binary_tree_stats_free.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @stats: Pointer to where the statistics are stored.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int binary_tree_stats(const binary_tree_t *tree, tree_stats_t *stats)
+{
+	size_t left_height, right_height;
+	int success = 1;
+
+	if (!stats)
+		return (0);
+	memset(stats, 0, sizeof(*stats));
+	if (!tree)
+		return (1);
+
+	stats->is_full = 1;
+	success = stats_visit(stats, tree, 0);
+	left_height = stats_walk(stats, tree->left, &success);
+	right_height = stats_walk(stats, tree->right, &success);
+	if (!success)
+	{
+		binary_tree_stats_free(stats);
+		return (0);
+	}
+
+	stats->balance = (int)left_height - (int)right_height;
+	stats->height = left_height > right_height ? left_height : right_height;
+	stats->levels = stats->height + 1;
+	stats->is_perfect = stats->is_full &&
+		stats->leaf_depths[stats->height] == stats->leaves;
+
+	return (1);
+}
+
+/**
+ * stats_walk - Adds the nodes of a subtree of the root to shape
+ *	statistics, depth first, with an explicit stack.
+ *
+ * @stats: Pointer to the statistics.
+ * @tree: Pointer to a child of the root.
+ * @success: Pointer to a flag cleared on failure.
+ *
+ * Return: Height of the subtree counted in nodes, which is also the
+ *	greatest depth reached in the whole tree.
+*/
+size_t stats_walk(tree_stats_t *stats, const binary_tree_t *tree,
+	int *success)
+{
+	reduce_task_t *stack = NULL, task;
+	size_t count = 0, capacity = 0, height = 0;
+
+	if (tree && *success)
+		*success = reduce_push(&stack, &count, &capacity, tree, 1);
+	while (*success && count)
+	{
+		task = stack[--count];
+		if (task.depth > height)
+			height = task.depth;
+		*success = stats_visit(stats, task.node, task.depth);
+		if (*success && task.node->right)
+			*success = reduce_push(&stack, &count, &capacity,
+				task.node->right, task.depth + 1);
+		if (*success && task.node->left)
+			*success = reduce_push(&stack, &count, &capacity,
+				task.node->left, task.depth + 1);
+	}
+	free(stack);
+
+	return (height);
+}
+
+/**
+ * stats_visit - Adds a node to shape statistics.
+ *
+ * Description: Nodes are visited depth first, so a node is never more
+ *	than one level below the deepest histogram slot already allocated.
+ *
+ * @stats: Pointer to the statistics.
+ * @node: Pointer to the node.
+ * @depth: Depth of the node.
+ *
+ * Return: 1 on success, 0 on failure.
+*/
+int stats_visit(tree_stats_t *stats, const binary_tree_t *node,
+	size_t depth)
+{
+	size_t *grown, levels;
+
+	if (depth == stats->levels)
+	{
+		levels = stats->levels ? stats->levels * 2 : 16;
+		grown = realloc(stats->depths, sizeof(*grown) * levels * 2);
+		if (!grown)
+			return (0);
+		memmove(grown + levels, grown + stats->levels,
+			sizeof(*grown) * stats->levels);
+		memset(grown + stats->levels, 0,
+			sizeof(*grown) * (levels - stats->levels));
+		memset(grown + levels + stats->levels, 0,
+			sizeof(*grown) * (levels - stats->levels));
+		stats->depths = grown;
+		stats->leaf_depths = grown + levels;
+		stats->levels = levels;
+	}
+
+	stats->size++;
+	stats->depths[depth]++;
+	if (!node->left && !node->right)
+	{
+		stats->leaves++;
+		stats->leaf_depths[depth]++;
+	}
+	else
+	{
+		stats->nodes++;
+		if (!node->left || !node->right)
+			stats->is_full = 0;
+	}
+
+	return (1);
+}
+
+/**
+ * binary_tree_stats_free - Releases the depth histograms of shape
+ *	statistics.
+ *
+ * @stats: Pointer to the statistics.
+*/
+void binary_tree_stats_free(tree_stats_t *stats)
+{
+	if (stats)
+	{
+		free(stats->depths);
+		stats->depths = NULL;
+		stats->leaf_depths = NULL;
+		stats->levels = 0;
+	}
+}
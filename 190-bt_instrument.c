@@ -0,0 +1,49 @@
+#include <string.h>
+#include "binary_trees.h"
+
+__thread bt_instrument_t bt_instrument;
+__thread bt_op_t bt_op_current;
+__thread size_t bt_op_depth;
+
+/**
+ * bt_op_enter - Attributes the counters of the calling thread to an
+ *	operation.
+ *
+ * Description: Calls nest, the outermost operation keeping the counters
+ *	of everything it calls, recursive calls included.
+ *
+ * @op: Operation being entered.
+*/
+void bt_op_enter(bt_op_t op)
+{
+	if (!bt_op_depth++)
+		bt_op_current = op;
+}
+
+/**
+ * bt_op_exit - Leaves the operation last entered by the calling thread.
+*/
+void bt_op_exit(void)
+{
+	if (bt_op_depth && !--bt_op_depth)
+		bt_op_current = BT_OP_OTHER;
+}
+
+/**
+ * bt_instrument_snapshot - Copies the counters of the calling thread.
+ *
+ * @snapshot: Pointer to where the counters are copied.
+*/
+void bt_instrument_snapshot(bt_instrument_t *snapshot)
+{
+	if (snapshot)
+		*snapshot = bt_instrument;
+}
+
+/**
+ * bt_instrument_reset - Sets the counters of the calling thread to 0.
+*/
+void bt_instrument_reset(void)
+{
+	memset(&bt_instrument, 0, sizeof(bt_instrument));
+}
@@ -0,0 +1,124 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * bt_writer_open - Creates a buffered writer of a stream.
+ *
+ * @stream: Stream to write to.
+ *
+ * Return: Pointer to the new writer, or NULL on failure.
+*/
+bt_writer_t *bt_writer_open(FILE *stream)
+{
+	bt_writer_t *writer;
+
+	if (!stream)
+		return (NULL);
+
+	writer = malloc(sizeof(*writer));
+	if (!writer)
+		return (NULL);
+	writer->stream = stream;
+	writer->len = 0;
+	writer->error = 0;
+
+	return (writer);
+}
+
+/**
+ * bt_write - Writes bytes through a writer.
+ *
+ * Description: Bytes are only written to the stream once the buffer is
+ *	full, and bytes that would not fit in it are written directly.
+ *
+ * @writer: Pointer to the writer.
+ * @buf: Bytes to write.
+ * @len: Number of bytes to write.
+*/
+void bt_write(bt_writer_t *writer, const char *buf, size_t len)
+{
+	if (writer->len + len > BT_WRITER_SIZE)
+	{
+		if (fwrite(writer->buf, 1, writer->len, writer->stream) !=
+			writer->len)
+			writer->error = 1;
+		writer->len = 0;
+	}
+	if (len > BT_WRITER_SIZE)
+	{
+		if (fwrite(buf, 1, len, writer->stream) != len)
+			writer->error = 1;
+		return;
+	}
+
+	memcpy(writer->buf + writer->len, buf, len);
+	writer->len += len;
+}
+
+/**
+ * bt_write_long - Writes an integer in decimal through a writer.
+ *
+ * @writer: Pointer to the writer.
+ * @value: Integer to write.
+*/
+void bt_write_long(bt_writer_t *writer, long value)
+{
+	char digits[24];
+	unsigned long u = value;
+	size_t i = sizeof(digits);
+
+	if (value < 0)
+		u = -u;
+	do {
+		digits[--i] = '0' + u % 10;
+		u /= 10;
+	} while (u);
+	if (value < 0)
+		digits[--i] = '-';
+
+	bt_write(writer, digits + i, sizeof(digits) - i);
+}
+
+/**
+ * bt_write_hex - Writes an integer in hexadecimal through a writer.
+ *
+ * @writer: Pointer to the writer.
+ * @value: Integer to write.
+*/
+void bt_write_hex(bt_writer_t *writer, uintptr_t value)
+{
+	char digits[2 * sizeof(value)];
+	size_t i = sizeof(digits);
+
+	do {
+		digits[--i] = "0123456789abcdef"[value & 15];
+		value >>= 4;
+	} while (value);
+
+	bt_write(writer, digits + i, sizeof(digits) - i);
+}
+
+/**
+ * bt_writer_close - Writes what is left in the buffer of a writer and
+ *	deletes it, leaving the stream open.
+ *
+ * @writer: Pointer to the writer.
+ *
+ * Return: 0 if every write succeeded, or -1 otherwise.
+*/
+int bt_writer_close(bt_writer_t *writer)
+{
+	int error;
+
+	if (!writer)
+		return (-1);
+
+	if (fwrite(writer->buf, 1, writer->len, writer->stream) !=
+		writer->len || fflush(writer->stream))
+		writer->error = 1;
+	error = writer->error;
+	free(writer);
+
+	return (error ? -1 : 0);
+}
@@ -0,0 +1,149 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+int export_walk(tree_export_t *state, const binary_tree_t *tree);
+int export_leave(tree_export_t *state, const binary_tree_t *node);
+
+/**
+ * binary_tree_export - Writes a binary tree to a stream in a format.
+ *
+ * @stream: Stream to write to.
+ * @tree: Pointer to the root node of the tree.
+ * @exporter: Pointer to the format.
+ * @flags: BT_EXPORT_* flags of the annotations to add to each node.
+ *
+ * Return: 0 on success, or -1 on failure.
+*/
+int binary_tree_export(FILE *stream, const binary_tree_t *tree,
+	const tree_exporter_t *exporter, int flags)
+{
+	tree_export_t state;
+	int status = 0;
+
+	if (!exporter)
+		return (-1);
+	memset(&state, 0, sizeof(state));
+	state.writer = bt_writer_open(stream);
+	if (!state.writer)
+		return (-1);
+	state.exporter = exporter;
+	state.flags = flags;
+
+	bt_write(state.writer, exporter->head, strlen(exporter->head));
+	if (tree)
+		status = export_walk(&state, tree);
+	else
+		bt_write(state.writer, exporter->empty,
+			strlen(exporter->empty));
+	bt_write(state.writer, exporter->tail, strlen(exporter->tail));
+
+	free(state.metrics);
+	if (bt_writer_close(state.writer))
+		status = -1;
+
+	return (status);
+}
+
+/**
+ * export_walk - Walks a binary tree depth-first, writing each node before,
+ *	between and after its subtrees.
+ *
+ * Description: The walk follows the parent pointers, so it needs no
+ *	stack however deep the tree is.
+ *
+ * @state: Pointer to the state of the export.
+ * @tree: Pointer to the root node of the tree.
+ *
+ * Return: 0 on success, or -1 on failure.
+*/
+int export_walk(tree_export_t *state, const binary_tree_t *tree)
+{
+	const tree_exporter_t *exporter = state->exporter;
+	const binary_tree_t *node = tree;
+	int down = 1;
+
+	while (node)
+	{
+		if (down && exporter->enter)
+			exporter->enter(state->writer, node);
+		if (down && node->left)
+		{
+			node = node->left;
+			continue;
+		}
+		if (exporter->middle)
+			exporter->middle(state->writer, node);
+		down = node->right != NULL;
+		if (down)
+		{
+			node = node->right;
+			continue;
+		}
+		while (node)
+		{
+			if (export_leave(state, node))
+				return (-1);
+			if (node == tree)
+				return (0);
+			down = node == node->parent->left;
+			node = node->parent;
+			if (down)
+				break;
+		}
+		down = 0;
+	}
+
+	return (0);
+}
+
+/**
+ * export_leave - Writes a node after its right subtree, joining the
+ *	annotations of its subtrees if any is asked for.
+ *
+ * @state: Pointer to the state of the export.
+ * @node: Pointer to the node.
+ *
+ * Return: 0 on success, or -1 on failure.
+*/
+int export_leave(tree_export_t *state, const binary_tree_t *node)
+{
+	tree_metrics_t metrics, left, right, *stack;
+	size_t left_height, right_height;
+
+	if (!state->flags)
+	{
+		if (state->exporter->leave)
+			state->exporter->leave(state->writer, node, NULL, 0);
+		return (0);
+	}
+
+	memset(&left, 0, sizeof(left));
+	memset(&right, 0, sizeof(right));
+	if (node->right)
+		right = state->metrics[--state->top];
+	if (node->left)
+		left = state->metrics[--state->top];
+	left_height = node->left ? left.height + 1 : 0;
+	right_height = node->right ? right.height + 1 : 0;
+	metrics.height = left_height > right_height ?
+		left_height : right_height;
+	metrics.balance = (int)left_height - (int)right_height;
+	metrics.size = 1 + left.size + right.size;
+
+	if (state->top == state->capacity)
+	{
+		stack = realloc(state->metrics, sizeof(*stack) *
+			(state->capacity ? state->capacity * 2 : 64));
+		if (!stack)
+			return (-1);
+		state->metrics = stack;
+		state->capacity = state->capacity ? state->capacity * 2 : 64;
+	}
+	state->metrics[state->top++] = metrics;
+	if (state->exporter->leave)
+		state->exporter->leave(state->writer, node, &metrics,
+			state->flags);
+
+	return (0);
+}
@@ -0,0 +1,89 @@
+#include "binary_trees.h"
+
+void dot_leave(bt_writer_t *writer, const binary_tree_t *node,
+	const tree_metrics_t *metrics, int flags);
+void dot_edge(bt_writer_t *writer, const binary_tree_t *node,
+	const binary_tree_t *child, int left);
+
+/**
+ * binary_tree_to_dot - Writes a binary tree as a Graphviz DOT graph.
+ *
+ * Description: Each node is named after its address and labelled with
+ *	its value, followed by the annotations asked for. Edges to left
+ *	children leave from the bottom left of their parent, and edges to
+ *	right children from the bottom right.
+ *
+ * @stream: Stream to write to.
+ * @tree: Pointer to the root node of the tree.
+ * @flags: BT_EXPORT_* flags of the annotations to add to each node.
+ *
+ * Return: 0 on success, or -1 on failure.
+*/
+int binary_tree_to_dot(FILE *stream, const binary_tree_t *tree, int flags)
+{
+	static const tree_exporter_t dot = {
+		"digraph tree {\n\tnode [shape=box];\n", "}\n", "",
+		NULL, NULL, &dot_leave
+	};
+
+	return (binary_tree_export(stream, tree, &dot, flags));
+}
+
+/**
+ * dot_leave - Writes a node and the edges to its children.
+ *
+ * @writer: Pointer to the writer.
+ * @node: Pointer to the node.
+ * @metrics: Pointer to the annotations of the node, or NULL.
+ * @flags: BT_EXPORT_* flags of the annotations to write.
+*/
+void dot_leave(bt_writer_t *writer, const binary_tree_t *node,
+	const tree_metrics_t *metrics, int flags)
+{
+	bt_write(writer, "\tn", 2);
+	bt_write_hex(writer, (uintptr_t)node);
+	bt_write(writer, " [label=\"", 9);
+	bt_write_long(writer, node->n);
+	if (metrics && (flags & BT_EXPORT_HEIGHT))
+	{
+		bt_write(writer, "\\nheight ", 9);
+		bt_write_long(writer, metrics->height);
+	}
+	if (metrics && (flags & BT_EXPORT_BALANCE))
+	{
+		bt_write(writer, "\\nbalance ", 10);
+		bt_write_long(writer, metrics->balance);
+	}
+	if (metrics && (flags & BT_EXPORT_SIZE))
+	{
+		bt_write(writer, "\\nsize ", 7);
+		bt_write_long(writer, metrics->size);
+	}
+	bt_write(writer, "\"];\n", 4);
+
+	if (node->left)
+		dot_edge(writer, node, node->left, 1);
+	if (node->right)
+		dot_edge(writer, node, node->right, 0);
+}
+
+/**
+ * dot_edge - Writes the edge from a node to one of its children.
+ *
+ * @writer: Pointer to the writer.
+ * @node: Pointer to the node.
+ * @child: Pointer to the child.
+ * @left: 1 if child is the left child, 0 if it is the right one.
+*/
+void dot_edge(bt_writer_t *writer, const binary_tree_t *node,
+	const binary_tree_t *child, int left)
+{
+	bt_write(writer, "\tn", 2);
+	bt_write_hex(writer, (uintptr_t)node);
+	bt_write(writer, " -> n", 5);
+	bt_write_hex(writer, (uintptr_t)child);
+	if (left)
+		bt_write(writer, " [tailport=sw];\n", 16);
+	else
+		bt_write(writer, " [tailport=se];\n", 16);
+}
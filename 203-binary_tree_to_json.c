@@ -0,0 +1,87 @@
+#include "binary_trees.h"
+
+void json_enter(bt_writer_t *writer, const binary_tree_t *node);
+void json_middle(bt_writer_t *writer, const binary_tree_t *node);
+void json_leave(bt_writer_t *writer, const binary_tree_t *node,
+	const tree_metrics_t *metrics, int flags);
+
+/**
+ * binary_tree_to_json - Writes a binary tree as JSON.
+ *
+ * Description: Each node is an object holding its value in "n", its
+ *	children in "left" and "right", null when missing, and the
+ *	annotations asked for in "height", "balance" and "size". An empty
+ *	tree is null.
+ *
+ * @stream: Stream to write to.
+ * @tree: Pointer to the root node of the tree.
+ * @flags: BT_EXPORT_* flags of the annotations to add to each node.
+ *
+ * Return: 0 on success, or -1 on failure.
+*/
+int binary_tree_to_json(FILE *stream, const binary_tree_t *tree, int flags)
+{
+	static const tree_exporter_t json = {
+		"", "\n", "null", &json_enter, &json_middle, &json_leave
+	};
+
+	return (binary_tree_export(stream, tree, &json, flags));
+}
+
+/**
+ * json_enter - Opens the object of a node, up to its left child.
+ *
+ * @writer: Pointer to the writer.
+ * @node: Pointer to the node.
+*/
+void json_enter(bt_writer_t *writer, const binary_tree_t *node)
+{
+	bt_write(writer, "{\"n\":", 5);
+	bt_write_long(writer, node->n);
+	bt_write(writer, ",\"left\":", 8);
+	if (!node->left)
+		bt_write(writer, "null", 4);
+}
+
+/**
+ * json_middle - Writes the key of the right child of a node.
+ *
+ * @writer: Pointer to the writer.
+ * @node: Pointer to the node.
+*/
+void json_middle(bt_writer_t *writer, const binary_tree_t *node)
+{
+	bt_write(writer, ",\"right\":", 9);
+	if (!node->right)
+		bt_write(writer, "null", 4);
+}
+
+/**
+ * json_leave - Closes the object of a node, after its annotations.
+ *
+ * @writer: Pointer to the writer.
+ * @node: Pointer to the node.
+ * @metrics: Pointer to the annotations of the node, or NULL.
+ * @flags: BT_EXPORT_* flags of the annotations to write.
+*/
+void json_leave(bt_writer_t *writer, const binary_tree_t *node,
+	const tree_metrics_t *metrics, int flags)
+{
+	(void)node;
+	if (metrics && (flags & BT_EXPORT_HEIGHT))
+	{
+		bt_write(writer, ",\"height\":", 10);
+		bt_write_long(writer, metrics->height);
+	}
+	if (metrics && (flags & BT_EXPORT_BALANCE))
+	{
+		bt_write(writer, ",\"balance\":", 11);
+		bt_write_long(writer, metrics->balance);
+	}
+	if (metrics && (flags & BT_EXPORT_SIZE))
+	{
+		bt_write(writer, ",\"size\":", 8);
+		bt_write_long(writer, metrics->size);
+	}
+	bt_write(writer, "}", 1);
+}
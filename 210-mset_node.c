@@ -0,0 +1,46 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+/**
+ * mset_node - Creates a node of a counted multiset, holding one occurrence
+ *	of a value.
+ *
+ * @parent: Pointer to the parent node.
+ * @value: Value to put in the new node.
+ *
+ * Return: Pointer to the new node, or NULL on failure.
+*/
+mset_t *mset_node(mset_t *parent, int value)
+{
+	mset_t *new_node = malloc(sizeof(mset_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->n = value;
+	new_node->height = 1;
+	new_node->count = 1;
+	new_node->total = 1;
+	new_node->parent = parent;
+	new_node->left = NULL;
+	new_node->right = NULL;
+
+	return (new_node);
+}
+
+/**
+ * mset_fix - Updates the height and the total count of a node from its
+ *	children.
+ *
+ * @node: Pointer to the node.
+*/
+void mset_fix(mset_t *node)
+{
+	int left = BT_AVL_HEIGHT(node->left);
+	int right = BT_AVL_HEIGHT(node->right);
+
+	node->height = (left > right ? left : right) + 1;
+	node->total = node->count + (node->left ? node->left->total : 0) +
+		(node->right ? node->right->total : 0);
+}
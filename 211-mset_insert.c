@@ -0,0 +1,49 @@
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+void mset_fix(mset_t *node);
+
+BT_LINKED_DEFINE(mset, mset_t)
+BT_AVL_DEFINE(mset, mset_t, mset_fix)
+
+/**
+ * mset_insert - Inserts one occurrence of a value in a counted multiset.
+ *
+ * Description: A value already in the multiset only has its count and
+ *	the total counts of its ancestors increased, without allocating a
+ *	node or rotating. A new value is linked as a leaf and the multiset
+ *	is rebalanced as an AVL tree.
+ *
+ * @tree: Double pointer to the root node of the multiset.
+ * @value: Value to insert.
+ *
+ * Return: Pointer to the node holding value, or NULL on failure.
+*/
+mset_t *mset_insert(mset_t **tree, int value)
+{
+	mset_t **link = tree, *parent = NULL, *node;
+
+	if (!tree)
+		return (NULL);
+
+	while (*link && (*link)->n != value)
+	{
+		parent = *link;
+		link = value < parent->n ? &parent->left : &parent->right;
+	}
+	if (*link)
+	{
+		(*link)->count++;
+		for (node = *link; node; node = node->parent)
+			node->total++;
+		return (*link);
+	}
+
+	node = mset_node(parent, value);
+	if (!node)
+		return (NULL);
+	*link = node;
+	mset_rebalance(tree, parent);
+
+	return (node);
+}
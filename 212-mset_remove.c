@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+void mset_fix(mset_t *node);
+void mset_unlink(mset_t **tree, mset_t *node);
+
+BT_LINKED_DEFINE(mset, mset_t)
+BT_AVL_DEFINE(mset, mset_t, mset_fix)
+
+/**
+ * mset_remove - Removes one occurrence of a value from a counted multiset.
+ *
+ * Description: The count of the value and the total counts of its
+ *	ancestors are decreased. The node is only unlinked, and the multiset
+ *	rebalanced, once its count drops to 0.
+ *
+ * @tree: Double pointer to the root node of the multiset.
+ * @value: Value to remove.
+ *
+ * Return: 1 if an occurrence was removed, or 0 if value is not found.
+*/
+int mset_remove(mset_t **tree, int value)
+{
+	mset_t *node = tree ? mset_search(*tree, value) : NULL;
+
+	if (!node)
+		return (0);
+
+	if (node->count == 1)
+	{
+		mset_unlink(tree, node);
+		return (1);
+	}
+	node->count--;
+	for (; node; node = node->parent)
+		node->total--;
+
+	return (1);
+}
+
+/**
+ * mset_unlink - Unlinks a node from a counted multiset and frees it.
+ *
+ * Description: A node with two children takes the value and the count of
+ *	its in-order successor, which is unlinked instead.
+ *
+ * @tree: Double pointer to the root node of the multiset.
+ * @node: Pointer to the node.
+*/
+void mset_unlink(mset_t **tree, mset_t *node)
+{
+	mset_t *next, *parent;
+
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->n = next->n;
+		node->count = next->count;
+		node = next;
+	}
+
+	parent = node->parent;
+	mset_replace(tree, node, node->left ? node->left : node->right);
+	free(node);
+	mset_rebalance(tree, parent);
+}
+
+/**
+ * mset_delete - Deletes a counted multiset.
+ *
+ * Description: The walk follows the parent pointers, so it needs no
+ *	stack however deep the multiset is.
+ *
+ * @tree: Pointer to the root node of the multiset.
+*/
+void mset_delete(mset_t *tree)
+{
+	mset_free(tree);
+}
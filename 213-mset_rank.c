@@ -0,0 +1,116 @@
+#include "binary_trees.h"
+
+/**
+ * mset_search - Searches for a value in a counted multiset.
+ *
+ * @tree: Pointer to the root node of the multiset.
+ * @value: Value to search for.
+ *
+ * Return: Pointer to the node holding value, or NULL if it is not found.
+*/
+mset_t *mset_search(const mset_t *tree, int value)
+{
+	while (tree && tree->n != value)
+		tree = value < tree->n ? tree->left : tree->right;
+
+	return ((mset_t *)tree);
+}
+
+/**
+ * mset_count - Counts the occurrences of a value in a counted multiset.
+ *
+ * @tree: Pointer to the root node of the multiset.
+ * @value: Value to count.
+ *
+ * Return: Number of occurrences of value.
+*/
+size_t mset_count(const mset_t *tree, int value)
+{
+	const mset_t *node = mset_search(tree, value);
+
+	return (node ? node->count : 0);
+}
+
+/**
+ * mset_rank - Counts the occurrences of the values lower than a value in
+ *	a counted multiset.
+ *
+ * Description: Going right past a node adds the total count of the
+ *	node less the one of its right subtree, so only one path is walked,
+ *	down to the node holding value if there is one.
+ *
+ * @tree: Pointer to the root node of the multiset.
+ * @value: Value to rank, which needs not be in the multiset.
+ *
+ * Return: Number of occurrences of values lower than value.
+*/
+size_t mset_rank(const mset_t *tree, int value)
+{
+	size_t rank = 0;
+
+	while (tree && tree->n != value)
+	{
+		if (value < tree->n)
+			tree = tree->left;
+		else
+		{
+			rank += tree->total -
+				(tree->right ? tree->right->total : 0);
+			tree = tree->right;
+		}
+	}
+	if (tree && tree->left)
+		rank += tree->left->total;
+
+	return (rank);
+}
+
+/**
+ * mset_range_count - Counts the occurrences of the values in a range in a
+ *	counted multiset.
+ *
+ * @tree: Pointer to the root node of the multiset.
+ * @lo: Lowest value of the range.
+ * @hi: Greatest value of the range.
+ *
+ * Return: Number of occurrences of values from lo to hi included.
+*/
+size_t mset_range_count(const mset_t *tree, int lo, int hi)
+{
+	if (lo > hi)
+		return (0);
+
+	return (mset_rank(tree, hi) + mset_count(tree, hi) -
+		mset_rank(tree, lo));
+}
+
+/**
+ * mset_select - Finds the value at a rank in a counted multiset, as if
+ *	every occurrence was stored in order.
+ *
+ * @tree: Pointer to the root node of the multiset.
+ * @rank: Number of occurrences lower than the one to find.
+ *
+ * Return: Pointer to the node holding the value, or NULL if rank is not
+ *	lower than the total count of the multiset.
+*/
+mset_t *mset_select(const mset_t *tree, size_t rank)
+{
+	size_t left;
+
+	while (tree)
+	{
+		left = tree->left ? tree->left->total : 0;
+		if (rank < left)
+			tree = tree->left;
+		else if (rank < left + tree->count)
+			break;
+		else
+		{
+			rank -= left + tree->count;
+			tree = tree->right;
+		}
+	}
+
+	return ((mset_t *)tree);
+}
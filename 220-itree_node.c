@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+/**
+ * itree_node - Creates a node of an interval tree.
+ *
+ * @parent: Pointer to the parent node.
+ * @lo: Start of the interval to put in the new node.
+ * @hi: End of the interval, not lower than lo.
+ *
+ * Return: Pointer to the new node, or NULL on failure.
+*/
+itree_t *itree_node(itree_t *parent, int lo, int hi)
+{
+	itree_t *new_node = malloc(sizeof(itree_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->lo = lo;
+	new_node->hi = hi;
+	new_node->max = hi;
+	new_node->height = 1;
+	new_node->parent = parent;
+	new_node->left = NULL;
+	new_node->right = NULL;
+
+	return (new_node);
+}
+
+/**
+ * itree_fix - Updates the height and the greatest end of the subtree of a
+ *	node from its children.
+ *
+ * @node: Pointer to the node.
+*/
+void itree_fix(itree_t *node)
+{
+	int left = BT_AVL_HEIGHT(node->left);
+	int right = BT_AVL_HEIGHT(node->right);
+
+	node->height = (left > right ? left : right) + 1;
+	node->max = node->hi;
+	if (node->left && node->left->max > node->max)
+		node->max = node->left->max;
+	if (node->right && node->right->max > node->max)
+		node->max = node->right->max;
+}
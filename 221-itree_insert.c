@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+void itree_fix(itree_t *node);
+void itree_unlink(itree_t **tree, itree_t *node);
+
+BT_LINKED_DEFINE(itree, itree_t)
+BT_AVL_DEFINE(itree, itree_t, itree_fix)
+
+/**
+ * itree_insert - Inserts an interval in an interval tree.
+ *
+ * Description: Intervals are ordered by start, then by end. The new node
+ *	is linked as a leaf and the tree is rebalanced as an AVL tree, the
+ *	rotations keeping the greatest end of each subtree.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @lo: Start of the interval.
+ * @hi: End of the interval, included.
+ *
+ * Return: Pointer to the new node, or NULL if lo is greater than hi, if
+ *	the interval is already in the tree or on failure.
+*/
+itree_t *itree_insert(itree_t **tree, int lo, int hi)
+{
+	itree_t **link = tree, *parent = NULL, *node;
+
+	if (!tree || lo > hi)
+		return (NULL);
+
+	while (*link)
+	{
+		parent = *link;
+		if (lo == parent->lo && hi == parent->hi)
+			return (NULL);
+		if (lo < parent->lo || (lo == parent->lo && hi < parent->hi))
+			link = &parent->left;
+		else
+			link = &parent->right;
+	}
+
+	node = itree_node(parent, lo, hi);
+	if (!node)
+		return (NULL);
+	*link = node;
+	itree_rebalance(tree, parent);
+
+	return (node);
+}
+
+/**
+ * itree_remove - Removes an interval from an interval tree.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @lo: Start of the interval.
+ * @hi: End of the interval.
+ *
+ * Return: 1 if the interval was removed, or 0 if it is not found.
+*/
+int itree_remove(itree_t **tree, int lo, int hi)
+{
+	itree_t *node = tree ? *tree : NULL;
+
+	while (node && (lo != node->lo || hi != node->hi))
+	{
+		if (lo < node->lo || (lo == node->lo && hi < node->hi))
+			node = node->left;
+		else
+			node = node->right;
+	}
+	if (!node)
+		return (0);
+
+	itree_unlink(tree, node);
+	return (1);
+}
+
+/**
+ * itree_unlink - Unlinks a node from an interval tree and frees it.
+ *
+ * Description: A node with two children takes the interval of its
+ *	in-order successor, which is unlinked instead.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @node: Pointer to the node.
+*/
+void itree_unlink(itree_t **tree, itree_t *node)
+{
+	itree_t *next, *parent;
+
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->lo = next->lo;
+		node->hi = next->hi;
+		node = next;
+	}
+
+	parent = node->parent;
+	itree_replace(tree, node, node->left ? node->left : node->right);
+	free(node);
+	itree_rebalance(tree, parent);
+}
+
+/**
+ * itree_delete - Deletes an interval tree.
+ *
+ * Description: The walk follows the parent pointers, so it needs no
+ *	stack however deep the tree is.
+ *
+ * @tree: Pointer to the root node of the tree.
+*/
+void itree_delete(itree_t *tree)
+{
+	itree_free(tree);
+}
@@ -0,0 +1,86 @@
+#include "binary_trees.h"
+
+/**
+ * itree_search - Finds an interval overlapping a range in an interval
+ *	tree.
+ *
+ * Description: If the left subtree ends before lo, no interval in it
+ *	overlaps. Otherwise, if none in it does, none in the right subtree
+ *	does either, as they all start after one that ends past lo starts.
+ *	So only one path is walked.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @lo: Start of the range.
+ * @hi: End of the range, included.
+ *
+ * Return: Pointer to a node whose interval overlaps the range, or NULL if
+ *	there is none.
+*/
+itree_t *itree_search(const itree_t *tree, int lo, int hi)
+{
+	while (tree && (tree->lo > hi || tree->hi < lo))
+	{
+		if (tree->left && tree->left->max >= lo)
+			tree = tree->left;
+		else
+			tree = tree->right;
+	}
+
+	return ((itree_t *)tree);
+}
+
+/**
+ * itree_overlap - Visits every interval overlapping a range in an interval
+ *	tree, in order.
+ *
+ * Description: Subtrees ending before lo are skipped, and so are the
+ *	right subtrees of the nodes starting after hi, so the walk only
+ *	leaves the paths to the intervals found to turn back.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @lo: Start of the range.
+ * @hi: End of the range, included.
+ * @func: Pointer to a function called with each node found and arg, or
+ *	NULL to only count them.
+ * @arg: Argument passed to func.
+ *
+ * Return: Number of intervals overlapping the range.
+*/
+size_t itree_overlap(const itree_t *tree, int lo, int hi,
+	void (*func)(const itree_t *node, void *arg), void *arg)
+{
+	size_t count;
+
+	if (!tree || tree->max < lo || lo > hi)
+		return (0);
+
+	count = itree_overlap(tree->left, lo, hi, func, arg);
+	if (tree->lo > hi)
+		return (count);
+	if (tree->hi >= lo)
+	{
+		if (func)
+			func(tree, arg);
+		count++;
+	}
+
+	return (count + itree_overlap(tree->right, lo, hi, func, arg));
+}
+
+/**
+ * itree_stab - Visits every interval holding a point in an interval tree,
+ *	in order.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @point: Point to stab the intervals with.
+ * @func: Pointer to a function called with each node found and arg, or
+ *	NULL to only count them.
+ * @arg: Argument passed to func.
+ *
+ * Return: Number of intervals holding point.
+*/
+size_t itree_stab(const itree_t *tree, int point,
+	void (*func)(const itree_t *node, void *arg), void *arg)
+{
+	return (itree_overlap(tree, point, point, func, arg));
+}
@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+
+void itree_fix(itree_t *node);
+itree_t *itree_build(const interval_t *array, size_t lo, size_t hi,
+	itree_t *parent);
+
+/**
+ * sorted_array_to_itree - Builds an interval tree from an array of
+ *	intervals sorted by start, then by end.
+ *
+ * Description: As in sorted_array_to_avl, the middle interval of each
+ *	range of the array becomes the root of its subtree, so the tree is
+ *	balanced without any rotation. Heights and greatest ends are set on
+ *	the way back up, in O(n) overall.
+ *
+ * @array: Pointer to the first interval of the array.
+ * @size: Number of intervals in the array.
+ *
+ * Return: Pointer to the root node of the created tree, or NULL if array
+ *	is NULL or empty, if it is not sorted, holds the same interval twice
+ *	or an interval ending before it starts, or on failure.
+*/
+itree_t *sorted_array_to_itree(const interval_t *array, size_t size)
+{
+	size_t i;
+
+	if (!array)
+		return (NULL);
+	for (i = 0; i < size; i++)
+	{
+		if (array[i].lo > array[i].hi)
+			return (NULL);
+		if (i && (array[i].lo < array[i - 1].lo ||
+			(array[i].lo == array[i - 1].lo &&
+			array[i].hi <= array[i - 1].hi)))
+			return (NULL);
+	}
+
+	return (itree_build(array, 0, size, NULL));
+}
+
+/**
+ * itree_build - Builds the subtree of a range of a sorted array of
+ *	intervals.
+ *
+ * @array: Pointer to the first interval of the array.
+ * @lo: Index of the first interval of the range.
+ * @hi: Index after the last interval of the range.
+ * @parent: Pointer to the parent of the subtree.
+ *
+ * Return: Pointer to the root node of the subtree, or NULL if the range
+ *	is empty or on failure, in which case nothing is left allocated.
+*/
+itree_t *itree_build(const interval_t *array, size_t lo, size_t hi,
+	itree_t *parent)
+{
+	size_t midpoint = lo + (hi - lo) / 2;
+	itree_t *node;
+
+	if (lo >= hi)
+		return (NULL);
+
+	node = itree_node(parent, array[midpoint].lo, array[midpoint].hi);
+	if (!node)
+		return (NULL);
+	node->left = itree_build(array, lo, midpoint, node);
+	node->right = itree_build(array, midpoint + 1, hi, node);
+	if ((lo < midpoint && !node->left) ||
+		(midpoint + 1 < hi && !node->right))
+	{
+		node->parent = NULL;
+		itree_delete(node);
+		return (NULL);
+	}
+	itree_fix(node);
+
+	return (node);
+}
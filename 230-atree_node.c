@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+/**
+ * atree_node - Creates a node of an aggregate tree.
+ *
+ * @parent: Pointer to the parent node.
+ * @key: Key to put in the new node.
+ * @value: Value of the key.
+ *
+ * Return: Pointer to the new node, or NULL on failure.
+*/
+atree_t *atree_node(atree_t *parent, int key, int value)
+{
+	atree_t *new_node = malloc(sizeof(atree_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->n = key;
+	new_node->value = value;
+	new_node->height = 1;
+	new_node->values.count = 1;
+	new_node->values.sum = value;
+	new_node->values.min = value;
+	new_node->values.max = value;
+	new_node->parent = parent;
+	new_node->left = NULL;
+	new_node->right = NULL;
+
+	return (new_node);
+}
+
+/**
+ * atree_fix - Updates the height and the aggregate of the values of the
+ *	subtree of a node from its children.
+ *
+ * @node: Pointer to the node.
+*/
+void atree_fix(atree_t *node)
+{
+	int left = BT_AVL_HEIGHT(node->left);
+	int right = BT_AVL_HEIGHT(node->right);
+
+	node->height = (left > right ? left : right) + 1;
+	node->values.count = 1;
+	node->values.sum = node->value;
+	node->values.min = node->value;
+	node->values.max = node->value;
+	if (node->left)
+		atree_merge(&node->values, &node->left->values);
+	if (node->right)
+		atree_merge(&node->values, &node->right->values);
+}
@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+#include "binary_trees_kv.h"
+
+void atree_fix(atree_t *node);
+void atree_unlink(atree_t **tree, atree_t *node);
+
+BT_LINKED_DEFINE(atree, atree_t)
+BT_AVL_DEFINE(atree, atree_t, atree_fix)
+
+/**
+ * atree_insert - Sets the value of a key in an aggregate tree.
+ *
+ * Description: A new key is linked as a leaf and the tree is rebalanced
+ *	as an AVL tree. The aggregates of the nodes above the one set are
+ *	updated on the way back to the root, in O(log(n)) either way.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @key: Key to set.
+ * @value: Value of the key, replacing the previous one if key is already
+ *	in the tree.
+ *
+ * Return: Pointer to the node holding key, or NULL on failure.
+*/
+atree_t *atree_insert(atree_t **tree, int key, int value)
+{
+	atree_t **link = tree, *parent = NULL, *node;
+
+	if (!tree)
+		return (NULL);
+
+	while (*link && (*link)->n != key)
+	{
+		parent = *link;
+		link = key < parent->n ? &parent->left : &parent->right;
+	}
+	if (*link)
+	{
+		node = *link;
+		node->value = value;
+		atree_rebalance(tree, node);
+		return (node);
+	}
+
+	node = atree_node(parent, key, value);
+	if (!node)
+		return (NULL);
+	*link = node;
+	atree_rebalance(tree, parent);
+
+	return (node);
+}
+
+/**
+ * atree_remove - Removes a key from an aggregate tree.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @key: Key to remove.
+ *
+ * Return: 1 if the key was removed, or 0 if it is not found.
+*/
+int atree_remove(atree_t **tree, int key)
+{
+	atree_t *node = tree ? atree_search(*tree, key) : NULL;
+
+	if (!node)
+		return (0);
+
+	atree_unlink(tree, node);
+	return (1);
+}
+
+/**
+ * atree_unlink - Unlinks a node from an aggregate tree and frees it.
+ *
+ * Description: A node with two children takes the key and the value of
+ *	its in-order successor, which is unlinked instead.
+ *
+ * @tree: Double pointer to the root node of the tree.
+ * @node: Pointer to the node.
+*/
+void atree_unlink(atree_t **tree, atree_t *node)
+{
+	atree_t *next, *parent;
+
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->n = next->n;
+		node->value = next->value;
+		node = next;
+	}
+
+	parent = node->parent;
+	atree_replace(tree, node, node->left ? node->left : node->right);
+	free(node);
+	atree_rebalance(tree, parent);
+}
+
+/**
+ * atree_delete - Deletes an aggregate tree.
+ *
+ * Description: The walk follows the parent pointers, so it needs no
+ *	stack however deep the tree is.
+ *
+ * @tree: Pointer to the root node of the tree.
+*/
+void atree_delete(atree_t *tree)
+{
+	atree_free(tree);
+}
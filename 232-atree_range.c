@@ -0,0 +1,134 @@
+#include <string.h>
+#include "binary_trees.h"
+
+void atree_range_from(const atree_t *tree, int lo, tree_values_t *values);
+void atree_range_to(const atree_t *tree, int hi, tree_values_t *values);
+
+/**
+ * atree_search - Searches for a key in an aggregate tree.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @key: Key to search for.
+ *
+ * Return: Pointer to the node holding key, or NULL if it is not found.
+*/
+atree_t *atree_search(const atree_t *tree, int key)
+{
+	while (tree && tree->n != key)
+		tree = key < tree->n ? tree->left : tree->right;
+
+	return ((atree_t *)tree);
+}
+
+/**
+ * atree_merge - Folds the statistics of some values into others.
+ *
+ * @values: Pointer to the statistics to fold into.
+ * @other: Pointer to the statistics to fold.
+*/
+void atree_merge(tree_values_t *values, const tree_values_t *other)
+{
+	if (!other->count)
+		return;
+	if (!values->count || other->min < values->min)
+		values->min = other->min;
+	if (!values->count || other->max > values->max)
+		values->max = other->max;
+	values->count += other->count;
+	values->sum += other->sum;
+}
+
+/**
+ * atree_range - Aggregates the values of the keys in a range of an
+ *	aggregate tree.
+ *
+ * Description: The walk goes down to the first node in the range, then
+ *	down both of its sides to the ends of the range, folding in the
+ *	aggregates of the subtrees in between as a whole, so it is in
+ *	O(log(n)) however many keys are in the range.
+ *
+ * @tree: Pointer to the root node of the tree.
+ * @lo: Lowest key of the range.
+ * @hi: Greatest key of the range.
+ * @values: Pointer to the statistics to fill, min and max being only
+ *	meaningful if count is not 0.
+ *
+ * Return: Number of keys in the range.
+*/
+size_t atree_range(const atree_t *tree, int lo, int hi,
+	tree_values_t *values)
+{
+	tree_values_t one;
+
+	if (!values)
+		return (0);
+	memset(values, 0, sizeof(*values));
+	while (tree && (tree->n < lo || tree->n > hi))
+		tree = tree->n < lo ? tree->right : tree->left;
+	if (!tree)
+		return (0);
+
+	one.count = 1;
+	one.sum = one.min = one.max = tree->value;
+	atree_merge(values, &one);
+	atree_range_from(tree->left, lo, values);
+	atree_range_to(tree->right, hi, values);
+
+	return (values->count);
+}
+
+/**
+ * atree_range_from - Folds the values of the keys from a lowest one in a
+ *	subtree.
+ *
+ * @tree: Pointer to the root node of the subtree.
+ * @lo: Lowest key to fold.
+ * @values: Pointer to the statistics to fold into.
+*/
+void atree_range_from(const atree_t *tree, int lo, tree_values_t *values)
+{
+	tree_values_t one;
+
+	one.count = 1;
+	while (tree)
+	{
+		if (tree->n < lo)
+		{
+			tree = tree->right;
+			continue;
+		}
+		one.sum = one.min = one.max = tree->value;
+		atree_merge(values, &one);
+		if (tree->right)
+			atree_merge(values, &tree->right->values);
+		tree = tree->left;
+	}
+}
+
+/**
+ * atree_range_to - Folds the values of the keys up to a greatest one in a
+ *	subtree.
+ *
+ * @tree: Pointer to the root node of the subtree.
+ * @hi: Greatest key to fold.
+ * @values: Pointer to the statistics to fold into.
+*/
+void atree_range_to(const atree_t *tree, int hi, tree_values_t *values)
+{
+	tree_values_t one;
+
+	one.count = 1;
+	while (tree)
+	{
+		if (tree->n > hi)
+		{
+			tree = tree->left;
+			continue;
+		}
+		one.sum = one.min = one.max = tree->value;
+		atree_merge(values, &one);
+		if (tree->left)
+			atree_merge(values, &tree->left->values);
+		tree = tree->right;
+	}
+}
@@ -0,0 +1,127 @@
+#include "binary_trees.h"
+
+/**
+ * bst_cursor_first - Places a cursor on the lowest value of a BST.
+ *
+ * Description: A cursor is only a node and the root of its tree, so it
+ *	takes no memory of its own and any number of cursors can walk the
+ *	same tree, or different trees, in turns. It stays valid as long as
+ *	the tree is not changed.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ *
+ * Return: Pointer to the node of the lowest value, or NULL if tree is
+ *	empty.
+*/
+const bst_t *bst_cursor_first(bst_cursor_t *cursor, const bst_t *tree)
+{
+	cursor->root = tree;
+	while (tree && tree->left)
+		tree = tree->left;
+	cursor->node = tree;
+
+	return (tree);
+}
+
+/**
+ * bst_cursor_last - Places a cursor on the greatest value of a BST.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ *
+ * Return: Pointer to the node of the greatest value, or NULL if tree is
+ *	empty.
+*/
+const bst_t *bst_cursor_last(bst_cursor_t *cursor, const bst_t *tree)
+{
+	cursor->root = tree;
+	while (tree && tree->right)
+		tree = tree->right;
+	cursor->node = tree;
+
+	return (tree);
+}
+
+/**
+ * bst_cursor_next - Moves a cursor to the next value of its BST.
+ *
+ * Description: The successor is the lowest node of the right subtree, or
+ *	the first ancestor reached from its left subtree. Each edge is
+ *	followed twice over a whole walk, so a step takes O(1) amortized.
+ *
+ * @cursor: Pointer to the cursor.
+ *
+ * Return: Pointer to the node of the next value, or NULL once past the
+ *	greatest one. A cursor past either end moves to the lowest value.
+*/
+const bst_t *bst_cursor_next(bst_cursor_t *cursor)
+{
+	const bst_t *node = cursor->node;
+
+	if (!node)
+		return (bst_cursor_first(cursor, cursor->root));
+
+	if (node->right)
+	{
+		for (node = node->right; node->left; node = node->left)
+			;
+	}
+	else
+	{
+		while (node->parent && node == node->parent->right)
+			node = node->parent;
+		node = node->parent;
+	}
+	cursor->node = node;
+
+	return (node);
+}
+
+/**
+ * bst_cursor_prev - Moves a cursor to the previous value of its BST.
+ *
+ * @cursor: Pointer to the cursor.
+ *
+ * Return: Pointer to the node of the previous value, or NULL once past the
+ *	lowest one. A cursor past either end moves to the greatest value.
+*/
+const bst_t *bst_cursor_prev(bst_cursor_t *cursor)
+{
+	const bst_t *node = cursor->node;
+
+	if (!node)
+		return (bst_cursor_last(cursor, cursor->root));
+
+	if (node->left)
+	{
+		for (node = node->left; node->right; node = node->right)
+			;
+	}
+	else
+	{
+		while (node->parent && node == node->parent->left)
+			node = node->parent;
+		node = node->parent;
+	}
+	cursor->node = node;
+
+	return (node);
+}
+
+/**
+ * bst_cursor_get - Reads the value a cursor is on.
+ *
+ * @cursor: Pointer to the cursor.
+ * @value: Pointer to store the value in.
+ *
+ * Return: 1 if the cursor is on a value, or 0 if it is past an end.
+*/
+int bst_cursor_get(const bst_cursor_t *cursor, int *value)
+{
+	if (!cursor->node)
+		return (0);
+
+	*value = cursor->node->n;
+	return (1);
+}
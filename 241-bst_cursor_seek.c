@@ -0,0 +1,94 @@
+#include "binary_trees.h"
+
+const bst_t *bst_cursor_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value, int strict);
+
+/**
+ * bst_cursor_seek - Places a cursor on a value of a BST.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ * @value: Value to seek.
+ *
+ * Return: Pointer to the node of value, or NULL if it is not in the tree,
+ *	the cursor being then past the ends.
+*/
+const bst_t *bst_cursor_seek(bst_cursor_t *cursor, const bst_t *tree,
+	int value)
+{
+	const bst_t *node = bst_cursor_bound(cursor, tree, value, 0);
+
+	if (node && node->n != value)
+		cursor->node = node = NULL;
+
+	return (node);
+}
+
+/**
+ * bst_cursor_lower_bound - Places a cursor on the lowest value of a BST
+ *	not lower than a value.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ * @value: Value to seek.
+ *
+ * Return: Pointer to the node found, or NULL if every value is lower.
+*/
+const bst_t *bst_cursor_lower_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value)
+{
+	return (bst_cursor_bound(cursor, tree, value, 0));
+}
+
+/**
+ * bst_cursor_upper_bound - Places a cursor on the lowest value of a BST
+ *	greater than a value.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ * @value: Value to seek.
+ *
+ * Return: Pointer to the node found, or NULL if no value is greater.
+*/
+const bst_t *bst_cursor_upper_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value)
+{
+	return (bst_cursor_bound(cursor, tree, value, 1));
+}
+
+/**
+ * bst_cursor_bound - Places a cursor on the lowest value of a BST greater
+ *	than, or equal to, a value.
+ *
+ * Description: The last node left to the left on the way down is the
+ *	lowest one above value, so one descent is enough.
+ *
+ * @cursor: Pointer to the cursor.
+ * @tree: Pointer to the root node of the BST.
+ * @value: Value to seek.
+ * @strict: 1 to skip a node equal to value, 0 to stop on it.
+ *
+ * Return: Pointer to the node found, or NULL if there is none.
+*/
+const bst_t *bst_cursor_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value, int strict)
+{
+	const bst_t *bound = NULL;
+
+	cursor->root = tree;
+	while (tree)
+	{
+		if (value < tree->n || (!strict && value == tree->n))
+		{
+			bound = tree;
+			if (value == tree->n)
+				break;
+			tree = tree->left;
+		}
+		else
+			tree = tree->right;
+	}
+	cursor->node = bound;
+
+	return (bound);
+}
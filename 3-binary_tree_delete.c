@@ -10,8 +10,11 @@ void binary_tree_delete(binary_tree_t *tree)
 {
 	if (tree)
 	{
+		BT_OP_ENTER(BT_OP_DELETE);
 		binary_tree_delete(tree->left);
 		binary_tree_delete(tree->right);
 		free(tree);
+		BT_COUNT(frees);
+		BT_OP_EXIT();
 	}
 }
@@ -0,0 +1,207 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "bench.h"
+
+double bench_measure(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, unsigned int timeout);
+void bench_child(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, unsigned int timeout);
+double bench_now(void);
+void bench_error(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, int status);
+
+/**
+ * bench_main - Runs benchmarks over every distribution at sizes growing
+ *	tenfold, printing one JSON object per line.
+ *
+ * Description: Usage is "driver [-n max_size] [-t timeout] [-b budget]
+ *	[-d distribution] [filter]". Only operations whose name contains
+ *	filter are run, and only over distribution if one is given. Each
+ *	measurement runs in its own process killed after timeout seconds,
+ *	and larger sizes are skipped once one takes more than budget seconds.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ * @driver: Name of the driver, reported with every result.
+ * @benches: Array of benchmarks.
+ * @count: Number of benchmarks.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int bench_main(int argc, char **argv, const char *driver,
+	const bench_t *benches, size_t count)
+{
+	size_t max = BENCH_MAX_SIZE, n, i;
+	unsigned int timeout = 30;
+	double budget = 2, elapsed;
+	const char *filter;
+	int opt, dist, first = 0, last = DIST_COUNT;
+
+	while ((opt = getopt(argc, argv, "n:t:b:d:")) != -1)
+	{
+		if (opt == 'n')
+			max = strtoul(optarg, NULL, 10);
+		else if (opt == 't')
+			timeout = strtoul(optarg, NULL, 10);
+		else if (opt == 'b')
+			budget = strtod(optarg, NULL);
+		else if (opt == 'd')
+			for (first = 0, last = 1; first < DIST_COUNT &&
+				strcmp(optarg, bench_dist_names[first]); last++)
+				first++;
+		else
+			return (1);
+	}
+	filter = optind < argc ? argv[optind] : NULL;
+	if (first == DIST_COUNT)
+		return (1);
+
+	for (i = 0; i < count; i++)
+	{
+		if (filter && !strstr(benches[i].name, filter))
+			continue;
+		for (dist = first; dist < last; dist++)
+		{
+			elapsed = 0;
+			for (n = BENCH_MIN_SIZE; n <= max && elapsed >= 0 &&
+				elapsed <= budget; n *= 10)
+				elapsed = bench_measure(driver, benches + i,
+					dist, n, timeout);
+		}
+	}
+
+	return (0);
+}
+
+/**
+ * bench_measure - Runs one measurement in a child process.
+ *
+ * @driver: Name of the driver.
+ * @bench: Pointer to the benchmark.
+ * @dist: Distribution of the keys.
+ * @n: Number of keys.
+ * @timeout: Number of seconds after which the child is killed.
+ *
+ * Return: Wall time of the child in seconds, or -1 if it failed.
+*/
+double bench_measure(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, unsigned int timeout)
+{
+	double start = bench_now();
+	pid_t pid;
+	int status;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid < 0)
+		return (-1);
+	if (!pid)
+		bench_child(driver, bench, dist, n, timeout);
+
+	if (waitpid(pid, &status, 0) < 0)
+		return (-1);
+	if (!WIFEXITED(status) || WEXITSTATUS(status))
+	{
+		bench_error(driver, bench, dist, n, status);
+		return (-1);
+	}
+
+	return (bench_now() - start);
+}
+
+/**
+ * bench_child - Times a benchmark and prints its result, then exits.
+ *
+ * @driver: Name of the driver.
+ * @bench: Pointer to the benchmark.
+ * @dist: Distribution of the keys.
+ * @n: Number of keys.
+ * @timeout: Number of seconds after which the process is killed.
+*/
+void bench_child(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, unsigned int timeout)
+{
+	struct rusage usage;
+	double start, stop;
+	size_t ops, allocs;
+	void *state = NULL;
+	int *keys;
+
+	alarm(timeout);
+	keys = bench_keys(dist, n, (unsigned int)n);
+	if (!keys)
+		exit(2);
+	if (bench->setup)
+		state = bench->setup(keys, n, bench->variant);
+
+	bench_allocs_reset();
+	bench_counters_reset();
+	start = bench_now();
+	ops = bench->run(state, keys, n, bench->variant);
+	stop = bench_now();
+	allocs = bench_allocs();
+	bench_counters_stop();
+	getrusage(RUSAGE_SELF, &usage);
+	if (bench->teardown)
+		bench->teardown(state);
+
+	printf("{\"driver\":\"%s\",\"op\":\"%s\",\"dist\":\"%s\",\"n\":%lu,"
+		"\"ops\":%lu,\"ns_per_op\":%.2f,\"allocs_per_op\":%.3f,"
+		"\"peak_rss_kb\":%ld", driver, bench->name,
+		bench_dist_names[dist], (unsigned long)n, (unsigned long)ops,
+		ops ? (stop - start) * 1e9 / ops : 0.0,
+		ops ? (double)allocs / ops : 0.0, usage.ru_maxrss);
+	bench_counters_print(ops);
+	printf("}\n");
+	fflush(stdout);
+
+	free(keys);
+	exit(0);
+}
+
+/**
+ * bench_now - Reads a monotonic clock.
+ *
+ * Return: Time in seconds.
+*/
+double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec + now.tv_nsec * 1e-9);
+}
+
+/**
+ * bench_error - Prints the result of a measurement that failed.
+ *
+ * @driver: Name of the driver.
+ * @bench: Pointer to the benchmark.
+ * @dist: Distribution of the keys.
+ * @n: Number of keys.
+ * @status: Status of the child process, as returned by waitpid.
+*/
+void bench_error(const char *driver, const bench_t *bench,
+	bench_dist_t dist, size_t n, int status)
+{
+	char error[32];
+
+	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+		strcpy(error, "timeout");
+	else if (WIFSIGNALED(status))
+		sprintf(error, "signal %d", WTERMSIG(status));
+	else
+		sprintf(error, "exit %d", WEXITSTATUS(status));
+
+	printf("{\"driver\":\"%s\",\"op\":\"%s\",\"dist\":\"%s\",\"n\":%lu,"
+		"\"error\":\"%s\"}\n", driver, bench->name,
+		bench_dist_names[dist], (unsigned long)n, error);
+}
@@ -0,0 +1,196 @@
+#ifndef _BENCH_H
+#define _BENCH_H
+
+#include "binary_trees.h"
+
+#define BENCH_MIN_SIZE 1000
+#define BENCH_MAX_SIZE 10000000
+#define SCALING_MAX_SIZES 16
+#define BENCH_BATCH_SIZE 10000
+#define BENCH_MAX_THREADS 16
+#define BENCH_MIXED_COUNT 30
+#define BENCH_MAX_METRICS 4
+
+/**
+ * enum bench_dist_e - Distributions of the keys fed to a benchmark
+ *
+ * @DIST_RANDOM: Distinct keys in random order
+ * @DIST_SORTED: Distinct keys in increasing order
+ * @DIST_REVERSE: Distinct keys in decreasing order
+ * @DIST_ZIPF: Keys drawn with Zipf frequencies, the k-th most frequent
+ *	key being drawn in proportion to 1/k
+ * @DIST_DUPLICATES: Keys drawn uniformly from a tenth as many values
+ * @DIST_COUNT: Number of distributions
+ */
+typedef enum bench_dist_e
+{
+	DIST_RANDOM,
+	DIST_SORTED,
+	DIST_REVERSE,
+	DIST_ZIPF,
+	DIST_DUPLICATES,
+	DIST_COUNT
+} bench_dist_t;
+
+/**
+ * struct bench_s - Benchmark of one operation
+ *
+ * @name: Name of the operation
+ * @setup: Pointer to a function building the state from the keys before
+ *	timing starts, or NULL for no state
+ * @run: Pointer to the timed function, returning the number of
+ *	operations performed
+ * @teardown: Pointer to a function releasing the state, or NULL
+ * @variant: Argument passed to setup and run, so one function can serve
+ *	several operations of the same shape
+ */
+typedef struct bench_s
+{
+	const char *name;
+	void *(*setup)(const int *keys, size_t n, int variant);
+	size_t (*run)(void *state, const int *keys, size_t n, int variant);
+	void (*teardown)(void *state);
+	int variant;
+} bench_t;
+
+/**
+ * struct bench_tree_s - State of the benchmarks of tree operations
+ *
+ * @root: Pointer to the root node of the tree
+ * @nodes: Array of the nodes of the tree, in insertion order
+ * @count: Number of nodes in nodes
+ * @array: Array of the distinct keys in increasing order
+ * @size: Number of keys in array
+ */
+typedef struct bench_tree_s
+{
+	binary_tree_t *root;
+	binary_tree_t **nodes;
+	size_t count;
+	int *array;
+	size_t size;
+} bench_tree_t;
+
+/**
+ * struct bench_event_s - Operation on a priority queue logged by a thread,
+ *	to be replayed in order once every thread is done
+ *
+ * @time: Time the operation returned at, in seconds
+ * @value: Value inserted or extracted
+ * @op: 1 for an insertion, -1 for an extraction, 0 if nothing was done
+ */
+typedef struct bench_event_s
+{
+	double time;
+	int value;
+	int op;
+} bench_event_t;
+
+/**
+ * struct bench_shared_s - State of the benchmarks of the structures
+ *	shared between threads, only the one benchmarked being created
+ *
+ * @cbst: Pointer to a lock-coupled BST
+ * @lfbst: Pointer to a lock-free BST
+ * @index: Pointer to a sharded index
+ * @mq: Pointer to a MultiQueue
+ * @keys: Array of the keys the state was created from
+ * @n: Number of keys in keys
+ * @events: Array of the operations logged, one for each key, or NULL
+ */
+typedef struct bench_shared_s
+{
+	cbst_t *cbst;
+	lfbst_t *lfbst;
+	sharded_index_t *index;
+	multiqueue_t *mq;
+	const int *keys;
+	size_t n;
+	bench_event_t *events;
+} bench_shared_t;
+
+/**
+ * struct bench_thread_s - Share of a workload run by one thread
+ *
+ * @thread: Id of the thread
+ * @barrier: Pointer to the barrier every thread starts from
+ * @work: Pointer to the function run on the share, returning its number
+ *	of operations
+ * @state: Pointer to the state shared by the threads
+ * @keys: Array of the keys of the share
+ * @n: Number of keys in keys
+ * @variant: Argument passed to work
+ * @tid: Index of the thread, from 0
+ * @ops: Number of operations returned by work
+ */
+typedef struct bench_thread_s
+{
+	pthread_t thread;
+	pthread_barrier_t *barrier;
+	size_t (*work)(void *state, const int *keys, size_t n, int variant,
+		int tid);
+	void *state;
+	const int *keys;
+	size_t n;
+	int variant;
+	int tid;
+	size_t ops;
+} bench_thread_t;
+
+/**
+ * struct scaling_claim_s - Complexity claimed for one operation, and the
+ *	measurements checked against it
+ *
+ * @op: Name of the operation, as reported by the drivers
+ * @class: Claimed class, such as "O(log(n))"
+ * @per_key: 1 if the class covers all n keys at once, as for a sort, while
+ *	the drivers report the time per key
+ * @count: Number of measurements
+ * @n: Array of the sizes measured
+ * @ns: Array of the measures per operation, comparisons and hops if
+ *	counted, otherwise nanoseconds
+ * @failed: Smallest size whose measurement failed, or 0
+ * @counted: 1 if the measures are instrumentation counters, 0 if times
+ */
+typedef struct scaling_claim_s
+{
+	const char *op;
+	const char *class;
+	int per_key;
+	size_t count;
+	double n[SCALING_MAX_SIZES];
+	double ns[SCALING_MAX_SIZES];
+	double failed;
+	int counted;
+} scaling_claim_t;
+
+int bench_main(int argc, char **argv, const char *driver,
+	const bench_t *benches, size_t count);
+
+int *bench_keys(bench_dist_t dist, size_t n, unsigned int seed);
+binary_tree_t *bench_build_bst(const int *keys, size_t n,
+	binary_tree_t **nodes, size_t *count);
+void bench_free_tree(binary_tree_t *tree);
+
+void *bench_setup_empty(const int *keys, size_t n, int variant);
+void *bench_setup_bst(const int *keys, size_t n, int variant);
+void *bench_setup_sorted(const int *keys, size_t n, int variant);
+void bench_teardown_tree(void *state);
+void bench_sink(int value);
+size_t bench_threads(void *state, const int *keys, size_t n, int variant,
+	size_t threads, size_t (*work)(void *state, const int *keys, size_t n,
+	int variant, int tid));
+
+double bench_rank_error(const int *keys, size_t n, bench_event_t *events,
+	size_t count);
+
+void bench_allocs_reset(void);
+size_t bench_allocs(void);
+void bench_counters_reset(void);
+void bench_counters_stop(void);
+void bench_report(const char *name, double value);
+void bench_counters_print(size_t ops);
+
+extern const char *bench_dist_names[DIST_COUNT];
+
+#endif /* _BENCH_H */
@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+static size_t bench_alloc_count;
+
+/**
+ * __wrap_malloc - Counts an allocation, with -Wl,--wrap=malloc.
+ *
+ * @size: Number of bytes to allocate.
+ *
+ * Return: Pointer to the allocated memory, or NULL on failure.
+*/
+void *__wrap_malloc(size_t size)
+{
+	__atomic_add_fetch(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+	return (__real_malloc(size));
+}
+
+/**
+ * __wrap_calloc - Counts an allocation, with -Wl,--wrap=calloc.
+ *
+ * @nmemb: Number of elements to allocate.
+ * @size: Size of an element.
+ *
+ * Return: Pointer to the allocated memory, or NULL on failure.
+*/
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+	__atomic_add_fetch(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+	return (__real_calloc(nmemb, size));
+}
+
+/**
+ * __wrap_realloc - Counts an allocation, with -Wl,--wrap=realloc.
+ *
+ * @ptr: Pointer to the memory to resize.
+ * @size: New size in bytes.
+ *
+ * Return: Pointer to the resized memory, or NULL on failure.
+*/
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	__atomic_add_fetch(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+	return (__real_realloc(ptr, size));
+}
+
+/**
+ * bench_allocs_reset - Sets the allocation count to 0.
+*/
+void bench_allocs_reset(void)
+{
+	__atomic_store_n(&bench_alloc_count, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * bench_allocs - Reads the allocation count.
+ *
+ * Return: Number of allocations since the last reset.
+*/
+size_t bench_allocs(void)
+{
+	return (__atomic_load_n(&bench_alloc_count, __ATOMIC_RELAXED));
+}
@@ -0,0 +1,124 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_atree(const int *keys, size_t n, int variant);
+void teardown_atree(void *state);
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_query(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the aggregate tree functions, each key being its own
+ *	value.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"atree_insert", &setup_atree, &run_insert, &teardown_atree, 0},
+		{"atree_search", &setup_atree, &run_query, &teardown_atree, 1},
+		{"atree_range", &setup_atree, &run_query, &teardown_atree, 2},
+		{"atree_range_wide", &setup_atree, &run_query, &teardown_atree,
+			3},
+		{"atree_remove", &setup_atree, &run_query, &teardown_atree, 4}
+	};
+
+	return (bench_main(argc, argv, "atree", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_atree - Creates the state of an aggregate tree benchmark, holding
+ *	the root of the tree. Queries (variants 1 and up) start from the
+ *	tree of the keys.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_atree(const int *keys, size_t n, int variant)
+{
+	atree_t **root = calloc(1, sizeof(*root));
+	size_t i;
+
+	for (i = 0; root && variant >= 1 && i < n; i++)
+		atree_insert(root, keys[i], keys[i]);
+
+	return (root);
+}
+
+/**
+ * teardown_atree - Deletes the state of an aggregate tree benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_atree(void *state)
+{
+	atree_t **root = state;
+
+	if (root)
+		atree_delete(*root);
+	free(root);
+}
+
+/**
+ * run_insert - Inserts every key in the tree.
+ *
+ * @state: Pointer to the state, starting empty.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	atree_t **root = state;
+	size_t i;
+
+	(void)variant;
+	for (i = 0; i < n; i++)
+		atree_insert(root, keys[i], keys[i]);
+
+	return (n);
+}
+
+/**
+ * run_query - Searches every key (variant 1), aggregates the values of the
+ *	hundred keys from it (variant 2) or of the keys from it to n / 2
+ *	past it (variant 3), or removes it (variant 4).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_query(void *state, const int *keys, size_t n, int variant)
+{
+	atree_t **root = state;
+	tree_values_t values;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 1)
+			bench_sink(!!atree_search(*root, keys[i]));
+		else if (variant == 2)
+			bench_sink(atree_range(*root, keys[i], keys[i] + 99,
+				&values));
+		else if (variant == 3)
+			bench_sink(atree_range(*root, keys[i],
+				keys[i] + (int)(n / 2), &values));
+		else
+			atree_remove(root, keys[i]);
+	}
+
+	return (n);
+}
@@ -0,0 +1,153 @@
+#include "bench.h"
+
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_search(void *state, const int *keys, size_t n, int variant);
+size_t run_check(void *state, const int *keys, size_t n, int variant);
+void *setup_avl(const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the AVL functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"avl_insert", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 0},
+		{"array_to_avl", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 1},
+		{"sorted_array_to_avl", &bench_setup_sorted, &run_insert,
+			&bench_teardown_tree, 2},
+		{"avl_insert_batch", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 3},
+		{"avl_insert_hint", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 4},
+		{"avl_search", &setup_avl, &run_search,
+			&bench_teardown_tree, 0},
+		{"avl_search_hint", &setup_avl, &run_search,
+			&bench_teardown_tree, 1},
+		{"binary_tree_is_avl", &setup_avl, &run_check,
+			&bench_teardown_tree, 0},
+		{"binary_tree_balance", &setup_avl, &run_check,
+			&bench_teardown_tree, 1}
+	};
+
+	return (bench_main(argc, argv, "avl", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * run_insert - Builds an AVL tree with avl_insert (variant 0),
+ *	array_to_avl (variant 1), sorted_array_to_avl (variant 2),
+ *	avl_insert_batch, BENCH_BATCH_SIZE keys at a time (variant 3), or
+ *	avl_insert_hint from the node inserted last (variant 4).
+ *
+ * @state: Pointer to the state, starting with an empty tree.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	avl_t *node = NULL;
+	size_t i;
+
+	if (variant == 1)
+		tree->root = array_to_avl((int *)keys, n);
+	if (variant == 2)
+		tree->root = sorted_array_to_avl(tree->array, tree->size);
+	for (i = 0; i < n && !variant; i++)
+		avl_insert(&tree->root, keys[i]);
+	for (i = 0; i < n && variant == 3; i += BENCH_BATCH_SIZE)
+		avl_insert_batch(&tree->root, keys + i,
+			n - i < BENCH_BATCH_SIZE ? n - i : BENCH_BATCH_SIZE);
+	for (i = 0; i < n && variant == 4; i++)
+		node = avl_insert_hint(&tree->root, node, keys[i]);
+
+	return (variant == 2 ? tree->size : n);
+}
+
+/**
+ * setup_avl - Creates the state of a benchmark working on the AVL tree
+ *	built from the distinct keys by sorted_array_to_avl.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_avl(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = bench_setup_sorted(keys, n, variant);
+
+	if (tree)
+		tree->root = sorted_array_to_avl(tree->array, tree->size);
+
+	return (tree);
+}
+
+/**
+ * run_search - Searches every key in the AVL tree with bst_search
+ *	(variant 0), or with bst_search_hint from the node found last
+ *	(variant 1).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys searched.
+*/
+size_t run_search(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	const avl_t *node = tree->root;
+	size_t i;
+
+	for (i = 0; i < n && !variant; i++)
+		bench_sink(!!bst_search(tree->root, keys[i]));
+	for (i = 0; i < n && variant; i++)
+	{
+		node = bst_search_hint(node ? node : tree->root, keys[i]);
+		bench_sink(!!node);
+	}
+
+	return (n);
+}
+
+/**
+ * run_check - Calls binary_tree_is_avl (variant 0) or binary_tree_balance
+ *	(variant 1) on the whole tree repeatedly, timing one call per
+ *	operation.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls.
+ * @variant: Function to time.
+ *
+ * Return: Number of calls.
+*/
+size_t run_check(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	size_t calls = 1 + 1000000 / n, i;
+
+	(void)keys;
+	for (i = 0; i < calls; i++)
+	{
+		if (variant)
+			bench_sink(binary_tree_balance(tree->root));
+		else
+			bench_sink(binary_tree_is_avl(tree->root));
+	}
+
+	return (calls);
+}
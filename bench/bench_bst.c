@@ -0,0 +1,212 @@
+#include <stdlib.h>
+#include "bench.h"
+
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_lookup(void *state, const int *keys, size_t n, int variant);
+size_t run_check(void *state, const int *keys, size_t n, int variant);
+size_t run_cursor(void *state, const int *keys, size_t n, int variant);
+void *setup_sgt(const int *keys, size_t n, int variant);
+size_t run_sgt_remove(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the BST functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"bst_insert", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 0},
+		{"array_to_bst", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 1},
+		{"bst_insert_batch", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 2},
+		{"sgt_insert", &bench_setup_empty, &run_insert,
+			&bench_teardown_tree, 3},
+		{"bst_search", &bench_setup_bst, &run_lookup,
+			&bench_teardown_tree, 0},
+		{"bst_remove", &bench_setup_bst, &run_lookup,
+			&bench_teardown_tree, 1},
+		{"binary_trees_ancestor", &bench_setup_bst, &run_lookup,
+			&bench_teardown_tree, 2},
+		{"bst_remove_sorted", &bench_setup_bst, &run_lookup,
+			&bench_teardown_tree, 3},
+		{"bst_search_hint", &bench_setup_bst, &run_lookup,
+			&bench_teardown_tree, 4},
+		{"binary_tree_is_bst", &bench_setup_bst, &run_check,
+			&bench_teardown_tree, 0},
+		{"bst_cursor_next", &bench_setup_bst, &run_cursor,
+			&bench_teardown_tree, 0},
+		{"bst_cursor_prev", &bench_setup_bst, &run_cursor,
+			&bench_teardown_tree, 1},
+		{"bst_cursor_lower_bound", &bench_setup_bst, &run_cursor,
+			&bench_teardown_tree, 2},
+		{"bst_cursor_upper_bound", &bench_setup_bst, &run_cursor,
+			&bench_teardown_tree, 3},
+		{"bst_cursor_seek", &bench_setup_bst, &run_cursor,
+			&bench_teardown_tree, 4},
+		{"sgt_remove", &setup_sgt, &run_sgt_remove,
+			&bench_teardown_tree, 0}
+	};
+
+	return (bench_main(argc, argv, "bst", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * run_insert - Builds a BST with bst_insert (variant 0), array_to_bst
+ *	(variant 1), bst_insert_batch, BENCH_BATCH_SIZE keys at a time
+ *	(variant 2), or sgt_insert (variant 3).
+ *
+ * @state: Pointer to the state, starting with an empty tree.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	sgt_t scapegoat = {NULL, 0, 0};
+	size_t i;
+
+	if (variant == 1)
+		tree->root = array_to_bst((int *)keys, n);
+	for (i = 0; i < n && !variant; i++)
+		bst_insert(&tree->root, keys[i]);
+	for (i = 0; i < n && variant == 2; i += BENCH_BATCH_SIZE)
+		bst_insert_batch(&tree->root, keys + i,
+			n - i < BENCH_BATCH_SIZE ? n - i : BENCH_BATCH_SIZE);
+	for (i = 0; i < n && variant == 3; i++)
+		sgt_insert(&scapegoat, keys[i]);
+	if (variant == 3)
+		tree->root = scapegoat.root;
+
+	return (n);
+}
+
+/**
+ * run_lookup - Searches every key with bst_search (variant 0), removes
+ *	every key with bst_remove (variant 1), finds the lowest common
+ *	ancestor of pairs of nodes (variant 2), removes every key in
+ *	increasing order, read with a cursor, in one bst_remove_sorted call
+ *	(variant 3), or searches every key with bst_search_hint from the node
+ *	found last (variant 4).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_lookup(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	bst_cursor_t cursor;
+	const bst_t *node;
+	int *sorted;
+	size_t i;
+
+	if (variant == 3)
+	{
+		sorted = malloc(sizeof(*sorted) * n);
+		if (!sorted)
+			return (0);
+		node = bst_cursor_first(&cursor, tree->root);
+		for (i = 0; node; node = bst_cursor_next(&cursor))
+			sorted[i++] = node->n;
+		tree->root = bst_remove_sorted(tree->root, sorted, i);
+		free(sorted);
+		return (i);
+	}
+	for (i = 0; i < n && variant == 0; i++)
+		bench_sink(!!bst_search(tree->root, keys[i]));
+	for (i = 0, node = tree->root; i < n && variant == 4; i++)
+	{
+		node = bst_search_hint(node ? node : tree->root, keys[i]);
+		bench_sink(!!node);
+	}
+	for (i = 0; i < n && variant == 1; i++)
+		tree->root = bst_remove(tree->root, keys[i]);
+	for (i = 0; i < tree->count && variant == 2; i++)
+		bench_sink(!!binary_trees_ancestor(tree->nodes[i],
+			tree->nodes[tree->count - 1 - i]));
+
+	return (variant == 2 ? tree->count : n);
+}
+
+/**
+ * run_check - Calls binary_tree_is_bst on the whole tree repeatedly,
+ *	timing one call per operation.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls.
+ * @variant: Unused.
+ *
+ * Return: Number of calls.
+*/
+size_t run_check(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	size_t calls = 1 + 1000000 / n, i;
+
+	(void)keys;
+	(void)variant;
+	for (i = 0; i < calls; i++)
+		bench_sink(binary_tree_is_bst(tree->root));
+
+	return (calls);
+}
+
+/**
+ * run_cursor - Walks the whole tree forward (variant 0) or backward
+ *	(variant 1) with a cursor, or places a cursor on every key with
+ *	bst_cursor_lower_bound (variant 2), bst_cursor_upper_bound (variant
+ *	3) or bst_cursor_seek (variant 4).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_cursor(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	bst_cursor_t cursor;
+	const bst_t *node;
+	size_t i;
+
+	for (i = 0; i < n && variant >= 2; i++)
+	{
+		if (variant == 2)
+			node = bst_cursor_lower_bound(&cursor, tree->root,
+				keys[i]);
+		else if (variant == 3)
+			node = bst_cursor_upper_bound(&cursor, tree->root,
+				keys[i]);
+		else
+			node = bst_cursor_seek(&cursor, tree->root, keys[i]);
+		bench_sink(!!node);
+	}
+	if (variant >= 2)
+		return (n);
+
+	i = 0;
+	node = variant ? bst_cursor_last(&cursor, tree->root) :
+		bst_cursor_first(&cursor, tree->root);
+	for (; node; i++)
+		node = variant ? bst_cursor_prev(&cursor) :
+			bst_cursor_next(&cursor);
+	bench_sink(i);
+
+	return (i);
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "binary_trees_kv.h"
+
+BT_KV_DEFINE(inl, int, void *)
+BT_KV_DEFINE_DYNAMIC(dyn, int, void *)
+
+/**
+ * struct cmp_state_s - State of a comparator benchmark, only the tree
+ *	benchmarked being used
+ *
+ * @inl: Pointer to the root of the tree comparing keys inline
+ * @dyn: Pointer to the root of the tree comparing keys through a pointer
+ * @tree: Pointer to the root of the int BST
+ */
+typedef struct cmp_state_s
+{
+	inl_node_t *inl;
+	dyn_node_t *dyn;
+	bst_t *tree;
+} cmp_state_t;
+
+int compare_int(int a, int b);
+void *setup_cmp(const int *keys, size_t n, int variant);
+void teardown_cmp(void *state);
+size_t run_cmp(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks BSTs of int keys compared inline, compared through a
+ *	function pointer, and the int BST functions they stand for.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"cmp_inline_insert", &setup_cmp, &run_cmp, &teardown_cmp, 0},
+		{"cmp_runtime_insert", &setup_cmp, &run_cmp, &teardown_cmp, 1},
+		{"cmp_int_insert", &setup_cmp, &run_cmp, &teardown_cmp, 2},
+		{"cmp_inline_search", &setup_cmp, &run_cmp, &teardown_cmp, 3},
+		{"cmp_runtime_search", &setup_cmp, &run_cmp, &teardown_cmp, 4},
+		{"cmp_int_search", &setup_cmp, &run_cmp, &teardown_cmp, 5}
+	};
+
+	dyn_set_compare(&compare_int);
+	return (bench_main(argc, argv, "cmp", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * compare_int - Compares two integers.
+ *
+ * @a: First integer.
+ * @b: Second integer.
+ *
+ * Return: Negative, 0 or positive as a is less than, equal to or greater
+ *	than b.
+*/
+int compare_int(int a, int b)
+{
+	return ((a > b) - (a < b));
+}
+
+/**
+ * setup_cmp - Creates the state of a comparator benchmark, its tree being
+ *	filled with the keys unless insertion is benchmarked.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_cmp(const int *keys, size_t n, int variant)
+{
+	cmp_state_t *state = calloc(1, sizeof(*state));
+	size_t i;
+
+	if (!state || variant < 3)
+		return (state);
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 3)
+			inl_bst_insert(&state->inl, keys[i], NULL);
+		else if (variant == 4)
+			dyn_bst_insert(&state->dyn, keys[i], NULL);
+		else
+			bst_insert(&state->tree, keys[i]);
+	}
+
+	return (state);
+}
+
+/**
+ * teardown_cmp - Deletes the state of a comparator benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_cmp(void *state)
+{
+	cmp_state_t *cmp = state;
+
+	inl_delete(cmp->inl);
+	dyn_delete(cmp->dyn);
+	bench_free_tree(cmp->tree);
+	free(cmp);
+}
+
+/**
+ * run_cmp - Inserts (variants 0 to 2) or searches (variants 3 to 5) every
+ *	key, comparing keys inline, through a function pointer or with the
+ *	int BST functions.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys.
+*/
+size_t run_cmp(void *state, const int *keys, size_t n, int variant)
+{
+	cmp_state_t *cmp = state;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 0)
+			inl_bst_insert(&cmp->inl, keys[i], NULL);
+		else if (variant == 1)
+			dyn_bst_insert(&cmp->dyn, keys[i], NULL);
+		else if (variant == 2)
+			bst_insert(&cmp->tree, keys[i]);
+		else if (variant == 3)
+			bench_sink(!!inl_search(cmp->inl, keys[i]));
+		else if (variant == 4)
+			bench_sink(!!dyn_search(cmp->dyn, keys[i]));
+		else
+			bench_sink(!!bst_search(cmp->tree, keys[i]));
+	}
+
+	return (n);
+}
@@ -0,0 +1,47 @@
+#include "bench.h"
+
+size_t run_check(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks binary_tree_is_complete, which cannot be linked with
+ *	the other tree functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"binary_tree_is_complete", &bench_setup_bst, &run_check,
+			&bench_teardown_tree, 0}
+	};
+
+	return (bench_main(argc, argv, "complete", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * run_check - Calls binary_tree_is_complete on the whole tree repeatedly,
+ *	timing one call per operation.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls.
+ * @variant: Unused.
+ *
+ * Return: Number of calls.
+*/
+size_t run_check(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	size_t calls = 1 + 1000000 / n, i;
+
+	(void)keys;
+	(void)variant;
+	for (i = 0; i < calls; i++)
+		bench_sink(binary_tree_is_complete(tree->root));
+
+	return (calls);
+}
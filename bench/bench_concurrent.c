@@ -0,0 +1,147 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_bst(const int *keys, size_t n, int variant);
+void teardown_shared(void *state);
+size_t run_cbst(void *state, const int *keys, size_t n, int variant);
+size_t run_lfbst(void *state, const int *keys, size_t n, int variant);
+size_t mixed_list(bench_t *benches);
+
+/**
+ * main - Benchmarks the lock-coupled and lock-free BST functions from a
+ *	single thread, then the trees shared by several threads.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static bench_t benches[6 + BENCH_MIXED_COUNT] = {
+		{"cbst_insert", &setup_bst, &run_cbst,
+			&teardown_shared, 0},
+		{"cbst_search", &setup_bst, &run_cbst,
+			&teardown_shared, 1},
+		{"cbst_remove", &setup_bst, &run_cbst,
+			&teardown_shared, 2},
+		{"lfbst_insert", &setup_bst, &run_lfbst,
+			&teardown_shared, 3},
+		{"lfbst_search", &setup_bst, &run_lfbst,
+			&teardown_shared, 4},
+		{"lfbst_remove", &setup_bst, &run_lfbst,
+			&teardown_shared, 5}
+	};
+	size_t count = 6;
+
+	count += mixed_list(benches + count);
+
+	return (bench_main(argc, argv, "concurrent", benches, count));
+}
+
+/**
+ * setup_bst - Creates the state of a concurrent BST benchmark, the tree
+ *	being filled with the keys unless insertion is benchmarked.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for, below 3 for the lock-coupled BST.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_bst(const int *keys, size_t n, int variant)
+{
+	bench_shared_t *state = calloc(1, sizeof(*state));
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	if (variant < 3)
+		state->cbst = cbst_create();
+	else
+		state->lfbst = lfbst_create();
+	for (i = 0; i < n && variant % 3; i++)
+	{
+		if (state->cbst)
+			cbst_insert(state->cbst, keys[i]);
+		else if (state->lfbst)
+			lfbst_insert(state->lfbst, keys[i], 0);
+	}
+
+	return (state);
+}
+
+/**
+ * teardown_shared - Releases the state of a shared structure benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_shared(void *state)
+{
+	bench_shared_t *shared = state;
+
+	if (shared)
+	{
+		cbst_delete(shared->cbst);
+		lfbst_delete(shared->lfbst);
+	}
+	free(shared);
+}
+
+/**
+ * run_cbst - Inserts, searches or removes every key in the lock-coupled
+ *	BST (variants 0 to 2).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_cbst(void *state, const int *keys, size_t n, int variant)
+{
+	cbst_t *tree = ((bench_shared_t *)state)->cbst;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 0)
+			bench_sink(cbst_insert(tree, keys[i]));
+		else if (variant == 1)
+			bench_sink(cbst_search(tree, keys[i]));
+		else
+			bench_sink(cbst_remove(tree, keys[i]));
+	}
+
+	return (n);
+}
+
+/**
+ * run_lfbst - Inserts, searches or removes every key in the lock-free BST
+ *	(variants 3 to 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_lfbst(void *state, const int *keys, size_t n, int variant)
+{
+	lfbst_t *tree = ((bench_shared_t *)state)->lfbst;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 3)
+			bench_sink(lfbst_insert(tree, keys[i], 0));
+		else if (variant == 4)
+			bench_sink(lfbst_search(tree, keys[i], 0));
+		else
+			bench_sink(lfbst_remove(tree, keys[i], 0));
+	}
+
+	return (n);
+}
@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include "bench.h"
+
+static const char *bench_metric_names[BENCH_MAX_METRICS];
+static double bench_metric_values[BENCH_MAX_METRICS];
+static size_t bench_metric_count;
+#ifdef BT_INSTRUMENT
+static bt_instrument_t bench_counters;
+#endif
+
+/**
+ * bench_counters_reset - Sets the instrumentation counters of the calling
+ *	thread to 0, if they are compiled in.
+*/
+void bench_counters_reset(void)
+{
+#ifdef BT_INSTRUMENT
+	bt_instrument_reset();
+#endif
+}
+
+/**
+ * bench_counters_stop - Keeps the instrumentation counters of the calling
+ *	thread as they are at the end of the timing, if they are compiled
+ *	in, so a teardown does not add to them.
+*/
+void bench_counters_stop(void)
+{
+#ifdef BT_INSTRUMENT
+	bt_instrument_snapshot(&bench_counters);
+#endif
+}
+
+/**
+ * bench_report - Reports a metric of a benchmark other than its time,
+ *	printed with its result.
+ *
+ * Description: Setup, run and teardown functions may all report metrics.
+ *	Those past BENCH_MAX_METRICS are dropped.
+ *
+ * @name: Name of the metric, used as the key of its JSON field.
+ * @value: Value of the metric.
+*/
+void bench_report(const char *name, double value)
+{
+	if (bench_metric_count < BENCH_MAX_METRICS)
+	{
+		bench_metric_names[bench_metric_count] = name;
+		bench_metric_values[bench_metric_count++] = value;
+	}
+}
+
+/**
+ * bench_counters_print - Prints the metrics reported and the
+ *	instrumentation counters kept by bench_counters_stop, if they are
+ *	compiled in, as fields of a JSON object.
+ *
+ * Description: The counters of every operation are added up, as a timed
+ *	function often makes several kinds of calls, and divided by the
+ *	number of operations timed. Only the calling thread is counted.
+ *
+ * @ops: Number of operations timed.
+*/
+void bench_counters_print(size_t ops)
+{
+	size_t i;
+#ifdef BT_INSTRUMENT
+	bt_counters_t sum = {0, 0, 0, 0, 0};
+
+	for (i = 0; i < BT_OP_COUNT; i++)
+	{
+		sum.comparisons += bench_counters.ops[i].comparisons;
+		sum.hops += bench_counters.ops[i].hops;
+		sum.rotations += bench_counters.ops[i].rotations;
+	}
+	printf(",\"comparisons_per_op\":%.2f,\"hops_per_op\":%.2f,"
+		"\"rotations_per_op\":%.3f",
+		(double)sum.comparisons / (ops ? ops : 1),
+		(double)sum.hops / (ops ? ops : 1),
+		(double)sum.rotations / (ops ? ops : 1));
+#else
+	(void)ops;
+#endif
+	for (i = 0; i < bench_metric_count; i++)
+		printf(",\"%s\":%.3f", bench_metric_names[i],
+			bench_metric_values[i]);
+}
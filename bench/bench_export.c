@@ -0,0 +1,43 @@
+#include <stdio.h>
+#include "bench.h"
+
+/**
+ * run_export - Writes the whole tree to /dev/null repeatedly, timing one
+ *	call per operation: binary_tree_fprint, which binary_tree_print
+ *	calls on stdout (variant 0), binary_tree_to_dot (variant 1) or
+ *	binary_tree_to_json (variant 2), the last two with every annotation.
+ *
+ * Description: The rendering of binary_tree_fprint is as wide as the
+ *	boxes of all the nodes and as high as the tree, so it grows
+ *	quadratically over sorted keys, for which the BST is a list.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls.
+ * @variant: Function to time.
+ *
+ * Return: Number of calls, or 0 if /dev/null cannot be opened.
+*/
+size_t run_export(void *state, const int *keys, size_t n, int variant)
+{
+	const binary_tree_t *root = ((bench_tree_t *)state)->root;
+	size_t calls = 1 + 1000000 / n, i;
+	int flags = BT_EXPORT_HEIGHT | BT_EXPORT_BALANCE | BT_EXPORT_SIZE;
+	FILE *stream = fopen("/dev/null", "w");
+
+	(void)keys;
+	if (!stream)
+		return (0);
+	for (i = 0; i < calls; i++)
+	{
+		if (variant == 0)
+			bench_sink(binary_tree_fprint(stream, root, 0));
+		else if (variant == 1)
+			bench_sink(binary_tree_to_dot(stream, root, flags));
+		else
+			bench_sink(binary_tree_to_json(stream, root, flags));
+	}
+	fclose(stream);
+
+	return (calls);
+}
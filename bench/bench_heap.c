@@ -0,0 +1,178 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+#define RUNS 16
+
+void *setup_heap(const int *keys, size_t n, int variant);
+void *setup_runs(const int *keys, size_t n, int variant);
+size_t run_array(void *state, const int *keys, size_t n, int variant);
+size_t run_extract(void *state, const int *keys, size_t n, int variant);
+int bench_compare(const void *a, const void *b);
+
+/**
+ * main - Benchmarks the heap functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"heap_insert", &bench_setup_empty, &run_array,
+			&bench_teardown_tree, 0},
+		{"array_to_heap", &bench_setup_empty, &run_array,
+			&bench_teardown_tree, 1},
+		{"heap_topk_push", &bench_setup_empty, &run_array,
+			&bench_teardown_tree, 2},
+		{"heap_sort", &bench_setup_sorted, &run_array,
+			&bench_teardown_tree, 3},
+		{"heap_merge", &setup_runs, &run_array,
+			&bench_teardown_tree, 4},
+		{"qsort", &bench_setup_sorted, &run_array,
+			&bench_teardown_tree, 5},
+		{"heap_extract", &setup_heap, &run_extract,
+			&bench_teardown_tree, 0},
+		{"heap_extract_many", &setup_heap, &run_extract,
+			&bench_teardown_tree, 1},
+		{"heap_extract_many_k16", &setup_heap, &run_extract,
+			&bench_teardown_tree, 3},
+		{"binary_tree_is_heap", &setup_heap, &run_extract,
+			&bench_teardown_tree, 2}
+	};
+
+	return (bench_main(argc, argv, "heap", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_heap - Creates the state of a benchmark working on the heap built
+ *	from the distinct keys by array_to_heap.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_heap(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = bench_setup_sorted(keys, n, variant);
+
+	if (tree)
+		tree->root = array_to_heap(tree->array, tree->size);
+
+	return (tree);
+}
+
+/**
+ * setup_runs - Creates the state of a benchmark merging sorted runs, the
+ *	distinct keys being dealt out to the runs in turn.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_runs(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = bench_setup_sorted(keys, n, variant);
+	int *runs;
+	size_t i, per_run;
+
+	if (!tree)
+		return (NULL);
+	per_run = (tree->size + RUNS - 1) / RUNS;
+	runs = malloc(sizeof(*runs) * (per_run * RUNS + 1));
+	if (!runs)
+	{
+		bench_teardown_tree(tree);
+		return (NULL);
+	}
+	for (i = 0; i < tree->size; i++)
+		runs[i % RUNS * per_run + i / RUNS] = tree->array[i];
+	free(tree->array);
+	tree->array = runs;
+
+	return (tree);
+}
+
+/**
+ * run_array - Times heap_insert, array_to_heap, heap_topk_push keeping the
+ *	100 largest keys, heap_sort of a copy of the keys, heap_merge of
+ *	RUNS runs, or the qsort of the C library on a copy of the keys, as
+ *	a baseline for heap_sort (variants 0 to 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys handled.
+*/
+size_t run_array(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	heap_topk_t *topk = variant == 2 ? heap_topk_create(100) : NULL;
+	size_t i, sizes[RUNS], per_run = (tree->size + RUNS - 1) / RUNS;
+	int *runs[RUNS], *out = variant == 4 ? malloc(sizeof(*out) * n) : NULL;
+
+	for (i = 0; i < n && variant == 0; i++)
+		heap_insert(&tree->root, keys[i]);
+	if (variant == 1)
+		tree->root = array_to_heap((int *)keys, n);
+	for (i = 0; i < n && topk; i++)
+		heap_topk_push(topk, keys[i]);
+	if (variant == 3 || variant == 5)
+		memcpy(tree->array, keys, sizeof(*keys) * n);
+	if (variant == 3)
+		heap_sort(tree->array, n);
+	if (variant == 5)
+		qsort(tree->array, n, sizeof(*keys), &bench_compare);
+	for (i = 0; i < RUNS && out; i++)
+	{
+		runs[i] = tree->array + i * per_run;
+		sizes[i] = tree->size / RUNS + (i < tree->size % RUNS);
+	}
+	if (out)
+		n = heap_merge(runs, sizes, RUNS, out);
+	heap_topk_delete(topk);
+	free(out);
+
+	return (n);
+}
+
+/**
+ * run_extract - Empties the heap with heap_extract (variant 0) or with
+ *	one call to heap_extract_many (variant 1), calls binary_tree_is_heap
+ *	repeatedly (variant 2), or extracts the 16 largest values with
+ *	heap_extract_many (variant 3), which should not depend on n.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls of binary_tree_is_heap.
+ * @variant: Operation to time.
+ *
+ * Return: Number of values extracted, or of calls.
+*/
+size_t run_extract(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	size_t i, calls = 1 + 1000000 / n;
+
+	(void)keys;
+	for (i = 0; i < tree->size && variant == 0; i++)
+		bench_sink(heap_extract(&tree->root));
+	if (variant == 1)
+		bench_sink(heap_extract_many(&tree->root, tree->size,
+			tree->array));
+	for (i = 0; i < calls && variant == 2; i++)
+		bench_sink(binary_tree_is_heap(tree->root));
+	if (variant == 3)
+		return (heap_extract_many(&tree->root, 16, tree->array));
+
+	return (variant == 2 ? calls : tree->size);
+}
@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include "bench.h"
+
+size_t index_work(void *state, const int *keys, size_t n, int variant,
+	int tid);
+
+/**
+ * setup_index_threads - Creates the state of a sharded index benchmark
+ *	with several inserting threads, the index being empty.
+ *
+ * Description: The index has four shards for each of the most threads
+ *	benchmarked, so that threads rarely wait for the same shard.
+ *
+ * @keys: Unused.
+ * @n: Unused.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_index_threads(const int *keys, size_t n, int variant)
+{
+	bench_shared_t *state = calloc(1, sizeof(*state));
+
+	(void)keys;
+	(void)n;
+	(void)variant;
+	if (state)
+		state->index = sharded_index_create(4 * BENCH_MAX_THREADS);
+
+	return (state);
+}
+
+/**
+ * run_index_threads - Splits the keys between threads inserting them in
+ *	the sharded index.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Number of threads.
+ *
+ * Return: Number of operations.
+*/
+size_t run_index_threads(void *state, const int *keys, size_t n,
+	int variant)
+{
+	return (bench_threads(state, keys, n, variant, variant, &index_work));
+}
+
+/**
+ * index_work - Inserts each key of the share of a thread in the sharded
+ *	index.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of the keys of the thread.
+ * @n: Number of keys.
+ * @variant: Unused.
+ * @tid: Unused.
+ *
+ * Return: Number of operations.
+*/
+size_t index_work(void *state, const int *keys, size_t n, int variant,
+	int tid)
+{
+	sharded_index_t *index = ((bench_shared_t *)state)->index;
+	size_t i;
+
+	(void)variant;
+	(void)tid;
+	for (i = 0; i < n; i++)
+		bench_sink(sharded_index_insert(index, keys[i]));
+
+	return (n);
+}
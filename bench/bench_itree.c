@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include "bench.h"
+
+#define ITREE_SPAN(key) ((key) + (key) % 64)
+
+void *setup_itree(const int *keys, size_t n, int variant);
+void teardown_itree(void *state);
+size_t run_update(void *state, const int *keys, size_t n, int variant);
+size_t run_query(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the interval tree functions, each key k standing for
+ *	the interval from k to k + k % 64.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"itree_insert", &setup_itree, &run_update, &teardown_itree, 0},
+		{"sorted_array_to_itree", &setup_itree, &run_update,
+			&teardown_itree, 1},
+		{"itree_search", &setup_itree, &run_query, &teardown_itree, 2},
+		{"itree_stab", &setup_itree, &run_query, &teardown_itree, 3},
+		{"itree_overlap", &setup_itree, &run_query, &teardown_itree, 4},
+		{"itree_remove", &setup_itree, &run_query, &teardown_itree, 5}
+	};
+
+	return (bench_main(argc, argv, "itree", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_itree - Creates the state of an interval tree benchmark, holding
+ *	the root of the tree. Queries (variants 2 and up) start from the tree
+ *	of the intervals of the keys.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_itree(const int *keys, size_t n, int variant)
+{
+	itree_t **root = calloc(1, sizeof(*root));
+	size_t i;
+
+	for (i = 0; root && variant >= 2 && i < n; i++)
+		itree_insert(root, keys[i], ITREE_SPAN(keys[i]));
+
+	return (root);
+}
+
+/**
+ * teardown_itree - Deletes the state of an interval tree benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_itree(void *state)
+{
+	itree_t **root = state;
+
+	if (root)
+		itree_delete(*root);
+	free(root);
+}
+
+/**
+ * run_update - Inserts the interval of every key (variant 0), or builds
+ *	the tree of the intervals of the keys 0 to n - 1 at once (variant 1).
+ *
+ * @state: Pointer to the state, starting empty.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of intervals inserted.
+*/
+size_t run_update(void *state, const int *keys, size_t n, int variant)
+{
+	itree_t **root = state;
+	interval_t *array;
+	size_t i;
+
+	if (variant == 0)
+	{
+		for (i = 0; i < n; i++)
+			itree_insert(root, keys[i], ITREE_SPAN(keys[i]));
+		return (n);
+	}
+
+	array = malloc(sizeof(*array) * n);
+	if (!array)
+		return (0);
+	for (i = 0; i < n; i++)
+	{
+		array[i].lo = i;
+		array[i].hi = ITREE_SPAN((int)i);
+	}
+	*root = sorted_array_to_itree(array, n);
+	free(array);
+
+	return (*root ? n : 0);
+}
+
+/**
+ * run_query - Finds one interval holding every key (variant 2), counts the
+ *	intervals holding it (variant 3) or overlapping the hundred values
+ *	from it (variant 4), or removes its interval (variant 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_query(void *state, const int *keys, size_t n, int variant)
+{
+	itree_t **root = state;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 2)
+			bench_sink(!!itree_search(*root, keys[i], keys[i]));
+		else if (variant == 3)
+			bench_sink(itree_stab(*root, keys[i], NULL, NULL));
+		else if (variant == 4)
+			bench_sink(itree_overlap(*root, keys[i], keys[i] + 99,
+				NULL, NULL));
+		else
+			itree_remove(root, keys[i], ITREE_SPAN(keys[i]));
+	}
+
+	return (n);
+}
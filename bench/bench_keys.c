@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void bench_shuffle(int *keys, size_t n, unsigned int *seed);
+int bench_zipf(const double *cdf, size_t n, unsigned int *seed);
+
+const char *bench_dist_names[DIST_COUNT] = {
+	"random", "sorted", "reverse", "zipf", "duplicates"
+};
+
+/**
+ * bench_keys - Generates keys following a distribution.
+ *
+ * @dist: Distribution of the keys.
+ * @n: Number of keys.
+ * @seed: Seed of the generator, the same seed giving the same keys.
+ *
+ * Return: Array of n keys, or NULL on failure.
+*/
+int *bench_keys(bench_dist_t dist, size_t n, unsigned int seed)
+{
+	int *keys = malloc(sizeof(*keys) * n);
+	double *cdf = NULL, sum = 0;
+	size_t i;
+
+	if (!keys || (dist == DIST_ZIPF && !(cdf = malloc(sizeof(*cdf) * n))))
+	{
+		free(keys);
+		return (NULL);
+	}
+
+	for (i = 0; i < n && cdf; i++)
+		cdf[i] = (sum += 1.0 / (i + 1));
+	for (i = 0; i < n; i++)
+	{
+		if (dist == DIST_REVERSE)
+			keys[i] = n - 1 - i;
+		else if (dist == DIST_ZIPF)
+			keys[i] = bench_zipf(cdf, n, &seed);
+		else if (dist == DIST_DUPLICATES)
+			keys[i] = rand_r(&seed) % (n / 10 + 1);
+		else
+			keys[i] = i;
+	}
+	if (dist == DIST_RANDOM)
+		bench_shuffle(keys, n, &seed);
+	free(cdf);
+
+	return (keys);
+}
+
+/**
+ * bench_shuffle - Shuffles keys in place (Fisher-Yates).
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @seed: Pointer to the state of the generator.
+*/
+void bench_shuffle(int *keys, size_t n, unsigned int *seed)
+{
+	size_t i, j;
+	int tmp;
+
+	for (i = n; i > 1; i--)
+	{
+		j = ((size_t)rand_r(seed) * ((size_t)RAND_MAX + 1) +
+			(size_t)rand_r(seed)) % i;
+		tmp = keys[i - 1];
+		keys[i - 1] = keys[j];
+		keys[j] = tmp;
+	}
+}
+
+/**
+ * bench_zipf - Draws a key with Zipf frequencies.
+ *
+ * Description: The rank drawn is scattered over [0, n) so the most
+ *	frequent keys are not also the smallest ones.
+ *
+ * @cdf: Array of the n cumulative, unnormalized rank weights.
+ * @n: Number of distinct keys.
+ * @seed: Pointer to the state of the generator.
+ *
+ * Return: The key drawn.
+*/
+int bench_zipf(const double *cdf, size_t n, unsigned int *seed)
+{
+	double target = cdf[n - 1] * rand_r(seed) / ((double)RAND_MAX + 1);
+	size_t lo = 0, hi = n - 1, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (cdf[mid] <= target)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return ((int)(lo * 7919 % n));
+}
+
+/**
+ * bench_build_bst - Builds a BST by inserting keys in order, ignoring
+ *	duplicates, without recursion so degenerate trees can be built.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @nodes: Array of at least n elements where the nodes are listed in
+ *	insertion order, or NULL.
+ * @count: Pointer to where the number of nodes is stored, or NULL.
+ *
+ * Return: Pointer to the root node of the tree.
+*/
+binary_tree_t *bench_build_bst(const int *keys, size_t n,
+	binary_tree_t **nodes, size_t *count)
+{
+	binary_tree_t *root = NULL, *node, **link;
+	size_t i, size = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		node = NULL;
+		link = &root;
+		while (*link && (*link)->n != keys[i])
+		{
+			node = *link;
+			link = keys[i] < node->n ? &node->left : &node->right;
+		}
+		if (*link)
+			continue;
+		*link = binary_tree_node(node, keys[i]);
+		if (*link && nodes)
+			nodes[size++] = *link;
+	}
+	if (count)
+		*count = size;
+
+	return (root);
+}
+
+/**
+ * bench_free_tree - Deletes a binary tree without recursion.
+ *
+ * Description: Left children are rotated up until the node at hand has
+ *	none, so the tree unrolls into a list freed as it goes.
+ *
+ * @tree: Pointer to the root node of the tree.
+*/
+void bench_free_tree(binary_tree_t *tree)
+{
+	binary_tree_t *next;
+
+	while (tree)
+	{
+		if (tree->left)
+		{
+			next = tree->left;
+			tree->left = next->right;
+			next->right = tree;
+		}
+		else
+		{
+			next = tree->right;
+			free(tree);
+		}
+		tree = next;
+	}
+}
@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "binary_trees_kv.h"
+
+BT_KV_DEFINE(kv, int64_t, void *)
+
+void *setup_kv(const int *keys, size_t n, int variant);
+void teardown_kv(void *state);
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_lookup(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the key/value trees, with 64-bit keys and pointer
+ *	values, to compare with the int trees.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"kv_bst_insert", &setup_kv, &run_insert, &teardown_kv, 0},
+		{"kv_avl_insert", &setup_kv, &run_insert, &teardown_kv, 1},
+		{"kv_heap_insert", &setup_kv, &run_insert, &teardown_kv, 2},
+		{"kv_search", &setup_kv, &run_lookup, &teardown_kv, 3},
+		{"kv_avl_remove", &setup_kv, &run_lookup, &teardown_kv, 4},
+		{"kv_heap_extract", &setup_kv, &run_lookup, &teardown_kv, 5}
+	};
+
+	return (bench_main(argc, argv, "kv", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_kv - Creates the state of a key/value benchmark, filled with the
+ *	keys unless insertion is benchmarked.
+ *
+ * Description: The state is a heap, whose root is also used as the root
+ *	of the AVL tree of the lookup benchmarks.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for, 5 for the heap.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_kv(const int *keys, size_t n, int variant)
+{
+	kv_heap_t *state = calloc(1, sizeof(*state));
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	for (i = 0; i < n && variant == 5; i++)
+		kv_heap_insert(state, keys[i], NULL);
+	for (i = 0; i < n && (variant == 3 || variant == 4); i++)
+		kv_avl_insert(&state->root, keys[i], NULL);
+
+	return (state);
+}
+
+/**
+ * teardown_kv - Deletes the state of a key/value benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_kv(void *state)
+{
+	kv_heap_delete(state);
+	free(state);
+}
+
+/**
+ * run_insert - Inserts every key in a BST (variant 0), an AVL tree
+ *	(variant 1) or a heap (variant 2).
+ *
+ * @state: Pointer to the state, starting empty.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	kv_heap_t *heap = state;
+	size_t i;
+
+	for (i = 0; i < n && variant == 0; i++)
+		kv_bst_insert(&heap->root, keys[i], NULL);
+	for (i = 0; i < n && variant == 1; i++)
+		kv_avl_insert(&heap->root, keys[i], NULL);
+	for (i = 0; i < n && variant == 2; i++)
+		kv_heap_insert(heap, keys[i], NULL);
+
+	return (n);
+}
+
+/**
+ * run_lookup - Searches every key in the AVL tree (variant 3), removes
+ *	every key from it (variant 4), or empties the heap (variant 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_lookup(void *state, const int *keys, size_t n, int variant)
+{
+	kv_heap_t *heap = state;
+	size_t i;
+
+	for (i = 0; i < n && variant == 3; i++)
+		bench_sink(!!kv_search(heap->root, keys[i]));
+	for (i = 0; i < n && variant == 4; i++)
+		kv_avl_remove(&heap->root, keys[i], NULL);
+	for (i = 0; i < n && variant == 5; i++)
+		bench_sink(kv_heap_extract(heap, NULL, NULL));
+
+	return (n);
+}
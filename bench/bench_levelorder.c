@@ -0,0 +1,45 @@
+#include "bench.h"
+
+size_t run_walk(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks binary_tree_levelorder, which cannot be linked with
+ *	the other tree functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"binary_tree_levelorder", &bench_setup_bst, &run_walk,
+			&bench_teardown_tree, 0}
+	};
+
+	return (bench_main(argc, argv, "levelorder", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * run_walk - Walks the whole tree once in level order.
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Unused.
+ * @variant: Unused.
+ *
+ * Return: Number of nodes walked.
+*/
+size_t run_walk(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+
+	(void)keys;
+	(void)n;
+	(void)variant;
+	binary_tree_levelorder(tree->root, &bench_sink);
+
+	return (tree->count);
+}
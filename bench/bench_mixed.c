@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_mixed(const int *keys, size_t n, int variant);
+void teardown_shared(void *state);
+size_t run_mixed(void *state, const int *keys, size_t n, int variant);
+size_t mixed_work(void *state, const int *keys, size_t n, int variant,
+	int tid);
+
+/**
+ * mixed_list - Lists the benchmarks of a shared BST used by several
+ *	threads at once.
+ *
+ * Description: Each benchmark is named after the tree, the percentage of
+ *	searches, the other operations being half insertions and half
+ *	removals, and the number of threads, such as "lfbst_r90_t4". The
+ *	number of threads doubles from 1 to BENCH_MAX_THREADS. The variant
+ *	holds the number of threads times 1000, plus the percentage of
+ *	searches times 10, plus 0 for the lock-coupled BST or 1 for the
+ *	lock-free one.
+ *
+ * @benches: Array of BENCH_MIXED_COUNT benchmarks to fill.
+ *
+ * Return: Number of benchmarks listed.
+*/
+size_t mixed_list(bench_t *benches)
+{
+	static const char * const trees[] = {"cbst", "lfbst"};
+	static const int reads[] = {100, 90, 50}, kinds[] = {0, 1};
+	static char names[BENCH_MIXED_COUNT][24];
+	size_t tree, read, threads, count = 0;
+
+	for (tree = 0; tree < sizeof(trees) / sizeof(*trees); tree++)
+		for (read = 0; read < sizeof(reads) / sizeof(*reads); read++)
+			for (threads = 1; threads <= BENCH_MAX_THREADS;
+				threads *= 2)
+			{
+				sprintf(names[count], "%s_r%d_t%lu",
+					trees[tree], reads[read],
+					(unsigned long)threads);
+				benches[count].name = names[count];
+				benches[count].setup = &setup_mixed;
+				benches[count].run = &run_mixed;
+				benches[count].teardown = &teardown_shared;
+				benches[count++].variant = threads * 1000 +
+					reads[read] * 10 + kinds[tree];
+			}
+
+	return (count);
+}
+
+/**
+ * setup_mixed - Creates the state of a shared BST benchmark, the tree
+ *	holding every other key.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_mixed(const int *keys, size_t n, int variant)
+{
+	bench_shared_t *state = calloc(1, sizeof(*state));
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	if (variant % 10)
+		state->lfbst = lfbst_create();
+	else
+		state->cbst = cbst_create();
+	for (i = 0; i < n; i += 2)
+	{
+		if (state->cbst)
+			cbst_insert(state->cbst, keys[i]);
+		else if (state->lfbst)
+			lfbst_insert(state->lfbst, keys[i], 0);
+	}
+
+	return (state);
+}
+
+/**
+ * run_mixed - Splits the keys between threads searching, inserting and
+ *	removing them in a shared BST.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark to run.
+ *
+ * Return: Number of operations.
+*/
+size_t run_mixed(void *state, const int *keys, size_t n, int variant)
+{
+	return (bench_threads(state, keys, n, variant, variant / 1000,
+		&mixed_work));
+}
+
+/**
+ * mixed_work - Searches, inserts or removes each key of the share of a
+ *	thread, the operation being drawn at random.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of the keys of the thread.
+ * @n: Number of keys.
+ * @variant: Benchmark to run.
+ * @tid: Index of the thread.
+ *
+ * Return: Number of operations.
+*/
+size_t mixed_work(void *state, const int *keys, size_t n, int variant,
+	int tid)
+{
+	bench_shared_t *shared = state;
+	unsigned int seed = 2654435761U * (tid + 1), roll;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		roll = seed % 200;
+		if (roll < (unsigned int)variant % 1000 / 10 * 2)
+			bench_sink(shared->cbst ? cbst_search(shared->cbst,
+				keys[i]) : lfbst_search(shared->lfbst, keys[i],
+				tid));
+		else if (roll & 1)
+			bench_sink(shared->cbst ? cbst_insert(shared->cbst,
+				keys[i]) : lfbst_insert(shared->lfbst, keys[i],
+				tid));
+		else
+			bench_sink(shared->cbst ? cbst_remove(shared->cbst,
+				keys[i]) : lfbst_remove(shared->lfbst, keys[i],
+				tid));
+	}
+
+	return (n);
+}
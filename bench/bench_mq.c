@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include "bench.h"
+
+double bench_now(void);
+void teardown_shared(void *state);
+size_t mq_work(void *state, const int *keys, size_t n, int variant,
+	int tid);
+
+/**
+ * setup_pc - Creates the state of a MultiQueue benchmark with producer
+ *	and consumer threads, the queue holding every key.
+ *
+ * Description: With two heaps for each thread, and the queue never
+ *	emptied, the consumers are rarely slowed down by the producers
+ *	or by a queue running out of values.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Number of threads.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_pc(const int *keys, size_t n, int variant)
+{
+	bench_shared_t *state = calloc(1, sizeof(*state));
+	unsigned int seed = 1;
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	state->mq = multiqueue_create(2 * variant);
+	state->keys = keys;
+	state->n = n;
+	state->events = malloc(sizeof(*state->events) * n);
+	if (!state->mq || !state->events)
+	{
+		free(state->events);
+		teardown_shared(state);
+		return (NULL);
+	}
+	for (i = 0; i < n; i++)
+		multiqueue_insert(state->mq, keys[i], &seed);
+
+	return (state);
+}
+
+/**
+ * run_pc - Splits the keys between producer threads inserting them in the
+ *	MultiQueue again and as many consumer threads extracting values.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Number of threads.
+ *
+ * Return: Number of operations.
+*/
+size_t run_pc(void *state, const int *keys, size_t n, int variant)
+{
+	return (bench_threads(state, keys, n, variant, variant, &mq_work));
+}
+
+/**
+ * mq_work - Inserts each key of the share of a thread in the MultiQueue,
+ *	for an even thread, or extracts as many values, for an odd one,
+ *	logging each operation.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of the keys of the thread.
+ * @n: Number of keys.
+ * @variant: Number of threads.
+ * @tid: Index of the thread.
+ *
+ * Return: Number of operations.
+*/
+size_t mq_work(void *state, const int *keys, size_t n, int variant,
+	int tid)
+{
+	bench_shared_t *shared = state;
+	bench_event_t *events = shared->events + (keys - shared->keys);
+	unsigned int seed = tid + 2;
+	size_t i;
+
+	(void)variant;
+	for (i = 0; i < n; i++)
+	{
+		if (tid % 2)
+			events[i].op = multiqueue_extract(shared->mq,
+				&events[i].value, &seed) ? -1 : 0;
+		else
+			events[i].op = multiqueue_insert(shared->mq,
+				events[i].value = keys[i], &seed);
+		events[i].time = bench_now();
+	}
+
+	return (n);
+}
+
+/**
+ * teardown_pc - Reports the rank error of the extractions of a MultiQueue
+ *	benchmark, then releases its state.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_pc(void *state)
+{
+	bench_shared_t *shared = state;
+
+	if (shared && shared->events)
+	{
+		bench_report("rank_error", bench_rank_error(shared->keys,
+			shared->n, shared->events, shared->n));
+		free(shared->events);
+	}
+	teardown_shared(state);
+}
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_mset(const int *keys, size_t n, int variant);
+void teardown_mset(void *state);
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_query(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the counted multiset functions, best run on the zipf
+ *	and duplicates distributions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"mset_insert", &setup_mset, &run_insert, &teardown_mset, 0},
+		{"mset_count", &setup_mset, &run_query, &teardown_mset, 1},
+		{"mset_rank", &setup_mset, &run_query, &teardown_mset, 2},
+		{"mset_select", &setup_mset, &run_query, &teardown_mset, 5},
+		{"mset_range_count", &setup_mset, &run_query, &teardown_mset,
+			3},
+		{"mset_remove", &setup_mset, &run_query, &teardown_mset, 4}
+	};
+
+	return (bench_main(argc, argv, "mset", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_mset - Creates the state of a multiset benchmark, holding the root
+ *	of the multiset. Queries (variants 1 and up) start from the multiset
+ *	of the keys.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_mset(const int *keys, size_t n, int variant)
+{
+	mset_t **root = calloc(1, sizeof(*root));
+	size_t i;
+
+	for (i = 0; root && variant >= 1 && i < n; i++)
+		mset_insert(root, keys[i]);
+
+	return (root);
+}
+
+/**
+ * teardown_mset - Deletes the state of a multiset benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_mset(void *state)
+{
+	mset_t **root = state;
+
+	if (root)
+		mset_delete(*root);
+	free(root);
+}
+
+/**
+ * run_insert - Inserts every key in the multiset.
+ *
+ * @state: Pointer to the state, starting empty.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	mset_t **root = state;
+	size_t i;
+
+	(void)variant;
+	for (i = 0; i < n; i++)
+		mset_insert(root, keys[i]);
+
+	return (n);
+}
+
+/**
+ * run_query - Counts every key (variant 1), ranks it (variant 2), counts
+ *	the keys in a range of a hundred values starting at it (variant 3),
+ *	removes one occurrence of it (variant 4), or finds the key at each
+ *	rank, in a scattered order (variant 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_query(void *state, const int *keys, size_t n, int variant)
+{
+	mset_t **root = state;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 1)
+			bench_sink(mset_count(*root, keys[i]));
+		else if (variant == 2)
+			bench_sink(mset_rank(*root, keys[i]));
+		else if (variant == 3)
+			bench_sink(mset_range_count(*root, keys[i],
+				keys[i] + 99));
+		else if (variant == 5)
+			bench_sink(!!mset_select(*root, i * 7919 % n));
+		else
+			mset_remove(root, keys[i]);
+	}
+
+	return (n);
+}
@@ -0,0 +1,44 @@
+#include "bench.h"
+
+/**
+ * run_parallel - Calls a parallel reduction of the whole tree repeatedly,
+ *	with 4 threads, timing one call per operation:
+ *	binary_tree_parallel_counts (variant 0),
+ *	binary_tree_parallel_values (variant 1) or
+ *	binary_tree_parallel_histogram over 64 bins (variant 2).
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls, and the wider the bins.
+ * @variant: Function to time.
+ *
+ * Return: Number of calls.
+*/
+size_t run_parallel(void *state, const int *keys, size_t n, int variant)
+{
+	const binary_tree_t *root = ((bench_tree_t *)state)->root;
+	size_t calls = 1 + 1000000 / n, i, bins[64];
+	tree_counts_t counts;
+	tree_values_t values;
+	tree_histogram_t histogram;
+
+	(void)keys;
+	histogram.lo = 0;
+	histogram.width = n / 64 + 1;
+	histogram.count = 64;
+	histogram.bins = bins;
+	for (i = 0; i < calls; i++)
+	{
+		if (variant == 0)
+			bench_sink(binary_tree_parallel_counts(root, 4,
+				&counts));
+		else if (variant == 1)
+			bench_sink(binary_tree_parallel_values(root, 4,
+				&values));
+		else
+			bench_sink(binary_tree_parallel_histogram(root, 4,
+				&histogram));
+	}
+
+	return (calls);
+}
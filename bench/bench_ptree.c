@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_ptree(const int *keys, size_t n, int variant);
+void teardown_ptree(void *state);
+size_t run_insert(void *state, const int *keys, size_t n, int variant);
+size_t run_query(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the persistent tree functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"pbst_insert", &setup_ptree, &run_insert, &teardown_ptree, 0},
+		{"pavl_insert", &setup_ptree, &run_insert, &teardown_ptree, 1},
+		{"ptree_search", &setup_ptree, &run_query, &teardown_ptree, 2},
+		{"ptree_height", &setup_ptree, &run_query, &teardown_ptree, 3},
+		{"pbst_remove", &setup_ptree, &run_query, &teardown_ptree, 4},
+		{"pavl_remove", &setup_ptree, &run_query, &teardown_ptree, 5}
+	};
+
+	return (bench_main(argc, argv, "ptree", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_ptree - Creates the state of a persistent tree benchmark, holding
+ *	the current version. Queries (variants 2 and up) start from the
+ *	persistent AVL tree of the keys.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_ptree(const int *keys, size_t n, int variant)
+{
+	ptree_t **root = calloc(1, sizeof(*root));
+	ptree_t *next;
+	size_t i;
+
+	for (i = 0; root && variant >= 2 && i < n; i++)
+	{
+		next = pavl_insert(*root, keys[i]);
+		ptree_release(*root);
+		*root = next;
+	}
+
+	return (root);
+}
+
+/**
+ * teardown_ptree - Releases the state of a persistent tree benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_ptree(void *state)
+{
+	ptree_t **root = state;
+
+	if (root)
+		ptree_release(*root);
+	free(root);
+}
+
+/**
+ * run_insert - Inserts every key with pbst_insert (variant 0) or
+ *	pavl_insert (variant 1), releasing each previous version.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of keys inserted.
+*/
+size_t run_insert(void *state, const int *keys, size_t n, int variant)
+{
+	ptree_t **root = state, *next;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant)
+			next = pavl_insert(*root, keys[i]);
+		else
+			next = pbst_insert(*root, keys[i]);
+		ptree_release(*root);
+		*root = next;
+	}
+
+	return (n);
+}
+
+/**
+ * run_query - Searches every key with ptree_search (variant 2), reads
+ *	ptree_height once per key (variant 3), or removes every key with
+ *	pbst_remove or pavl_remove (variants 4 and 5), releasing each
+ *	previous version.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_query(void *state, const int *keys, size_t n, int variant)
+{
+	ptree_t **root = state, *next;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 2)
+			bench_sink(!!ptree_search(*root, keys[i]));
+		else if (variant == 3)
+			bench_sink(ptree_height(*root));
+		else
+		{
+			if (variant == 4)
+				next = pbst_remove(*root, keys[i]);
+			else
+				next = pavl_remove(*root, keys[i]);
+			ptree_release(*root);
+			*root = next;
+		}
+	}
+
+	return (n);
+}
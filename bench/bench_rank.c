@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+size_t rank_index(const int *values, size_t n, int value);
+void rank_add(long *counts, size_t n, size_t index, long delta);
+long rank_sum(const long *counts, size_t index);
+int rank_compare(const void *a, const void *b);
+int bench_compare(const void *a, const void *b);
+
+/**
+ * bench_rank_error - Measures how far from the largest value the
+ *	extractions from a relaxed priority queue were.
+ *
+ * Description: The queue starts with the keys, then the events of every
+ *	thread are replayed in the order they returned in. The rank error of
+ *	an extraction is the number of values then in the queue greater than
+ *	the one extracted, 0 for a strict priority queue. The values are
+ *	counted in a Fenwick tree over the sorted keys, so the replay is in
+ *	O((n + count) * log(n)). Every value inserted must be one of the keys.
+ *
+ * @keys: Array of the keys the queue starts with.
+ * @n: Number of keys.
+ * @events: Array of events, sorted by time in place.
+ * @count: Number of events.
+ *
+ * Return: Average rank error of the extractions, or -1 on failure.
+*/
+double bench_rank_error(const int *keys, size_t n, bench_event_t *events,
+	size_t count)
+{
+	int *values = malloc(sizeof(*values) * n);
+	long *counts = calloc(n + 1, sizeof(*counts)), total = n;
+	size_t i, index, extractions = 0;
+	double error = 0;
+
+	if (!values || !counts)
+	{
+		free(values);
+		free(counts);
+		return (-1);
+	}
+	memcpy(values, keys, sizeof(*values) * n);
+	qsort(values, n, sizeof(*values), &bench_compare);
+	for (i = 0; i < n; i++)
+		rank_add(counts, n, rank_index(values, n, keys[i]), 1);
+	qsort(events, count, sizeof(*events), &rank_compare);
+	for (i = 0; i < count; i++)
+	{
+		if (!events[i].op)
+			continue;
+		index = rank_index(values, n, events[i].value);
+		if (events[i].op < 0)
+		{
+			error += total - rank_sum(counts, index);
+			extractions++;
+		}
+		rank_add(counts, n, index, events[i].op);
+		total += events[i].op;
+	}
+	free(values);
+	free(counts);
+
+	return (extractions ? error / extractions : 0);
+}
+
+/**
+ * rank_index - Finds the index of a value in a sorted array.
+ *
+ * @values: Array of values, increasing.
+ * @n: Number of values.
+ * @value: Value to find.
+ *
+ * Return: Index of the first value not lower than value.
+*/
+size_t rank_index(const int *values, size_t n, int value)
+{
+	size_t lo = 0, hi = n, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (values[mid] < value)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return (lo);
+}
+
+/**
+ * rank_add - Adds to the count of a value in a Fenwick tree.
+ *
+ * @counts: Fenwick tree of n + 1 counts, the first one unused.
+ * @n: Number of values counted.
+ * @index: Index of the value in the sorted array.
+ * @delta: Number to add to its count.
+*/
+void rank_add(long *counts, size_t n, size_t index, long delta)
+{
+	for (index++; index <= n; index += index & -index)
+		counts[index] += delta;
+}
+
+/**
+ * rank_sum - Counts the values up to one in a Fenwick tree.
+ *
+ * @counts: Fenwick tree.
+ * @index: Index of the last value counted in the sorted array.
+ *
+ * Return: Number of values at indices up to index.
+*/
+long rank_sum(const long *counts, size_t index)
+{
+	long sum = 0;
+
+	for (index++; index; index -= index & -index)
+		sum += counts[index];
+
+	return (sum);
+}
+
+/**
+ * rank_compare - Compares two events by time for qsort.
+ *
+ * @a: Pointer to the first event.
+ * @b: Pointer to the second event.
+ *
+ * Return: Negative, 0 or positive as a returned before, with or after b.
+*/
+int rank_compare(const void *a, const void *b)
+{
+	double x = ((const bench_event_t *)a)->time;
+	double y = ((const bench_event_t *)b)->time;
+
+	return ((x > y) - (x < y));
+}
@@ -0,0 +1,57 @@
+#include "bench.h"
+
+/**
+ * setup_sgt - Creates the state of a benchmark working on the scapegoat
+ *	tree built by inserting the keys in order with sgt_insert.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, its size being the number of nodes of the
+ *	tree, or NULL on failure.
+*/
+void *setup_sgt(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *state = bench_setup_empty(keys, n, variant);
+	sgt_t scapegoat = {NULL, 0, 0};
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	for (i = 0; i < n; i++)
+		sgt_insert(&scapegoat, keys[i]);
+	state->root = scapegoat.root;
+	state->size = scapegoat.size;
+
+	return (state);
+}
+
+/**
+ * run_sgt_remove - Removes every key from the scapegoat tree with
+ *	sgt_remove, including the rebuilds of the whole tree each time it
+ *	loses half of its nodes.
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Number of keys.
+*/
+size_t run_sgt_remove(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	sgt_t scapegoat;
+	size_t i;
+
+	(void)variant;
+	scapegoat.root = tree->root;
+	scapegoat.size = tree->size;
+	scapegoat.max_size = tree->size;
+	for (i = 0; i < n; i++)
+		bench_sink(sgt_remove(&scapegoat, keys[i]));
+	tree->root = scapegoat.root;
+
+	return (n);
+}
@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include "bench.h"
+
+void *setup_shared(const int *keys, size_t n, int variant);
+void teardown_shared(void *state);
+size_t run_index(void *state, const int *keys, size_t n, int variant);
+size_t run_mq(void *state, const int *keys, size_t n, int variant);
+void *setup_pc(const int *keys, size_t n, int variant);
+size_t run_pc(void *state, const int *keys, size_t n, int variant);
+void teardown_pc(void *state);
+void *setup_index_threads(const int *keys, size_t n, int variant);
+size_t run_index_threads(void *state, const int *keys, size_t n,
+	int variant);
+
+/**
+ * main - Benchmarks the sharded index and MultiQueue functions from a
+ *	single thread, then the index shared by inserting threads and the
+ *	MultiQueue shared by producer and consumer threads.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"sharded_index_insert", &setup_shared, &run_index,
+			&teardown_shared, 0},
+		{"sharded_index_insert_batch", &setup_shared, &run_index,
+			&teardown_shared, 1},
+		{"sharded_index_search", &setup_shared, &run_index,
+			&teardown_shared, 2},
+		{"sharded_iter_next", &setup_shared, &run_index,
+			&teardown_shared, 3},
+		{"multiqueue_insert", &setup_shared, &run_mq,
+			&teardown_shared, 4},
+		{"multiqueue_extract", &setup_shared, &run_mq,
+			&teardown_shared, 5},
+		{"sharded_index_insert_t1", &setup_index_threads,
+			&run_index_threads, &teardown_shared, 1},
+		{"sharded_index_insert_t2", &setup_index_threads,
+			&run_index_threads, &teardown_shared, 2},
+		{"sharded_index_insert_t4", &setup_index_threads,
+			&run_index_threads, &teardown_shared, 4},
+		{"sharded_index_insert_t8", &setup_index_threads,
+			&run_index_threads, &teardown_shared, 8},
+		{"sharded_index_insert_t16", &setup_index_threads,
+			&run_index_threads, &teardown_shared, 16},
+		{"multiqueue_pc_t2", &setup_pc, &run_pc, &teardown_pc, 2},
+		{"multiqueue_pc_t4", &setup_pc, &run_pc, &teardown_pc, 4},
+		{"multiqueue_pc_t8", &setup_pc, &run_pc, &teardown_pc, 8},
+		{"multiqueue_pc_t16", &setup_pc, &run_pc, &teardown_pc, 16}
+	};
+
+	return (bench_main(argc, argv, "sharded", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * setup_shared - Creates the state of a sharded index (variants 0 to 3)
+ *	or MultiQueue (variants 4 and 5) benchmark, filled with the keys
+ *	unless insertion is benchmarked.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Benchmark the state is for.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *setup_shared(const int *keys, size_t n, int variant)
+{
+	bench_shared_t *state = calloc(1, sizeof(*state));
+	unsigned int seed = 1;
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	if (variant < 4)
+		state->index = sharded_index_create(16);
+	else
+		state->mq = multiqueue_create(8);
+	for (i = 0; i < n && (variant == 2 || variant == 3); i++)
+		sharded_index_insert(state->index, keys[i]);
+	for (i = 0; i < n && variant == 5; i++)
+		multiqueue_insert(state->mq, keys[i], &seed);
+
+	return (state);
+}
+
+/**
+ * teardown_shared - Releases the state of a shared structure benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void teardown_shared(void *state)
+{
+	bench_shared_t *shared = state;
+
+	if (shared)
+	{
+		sharded_index_delete(shared->index);
+		multiqueue_delete(shared->mq);
+	}
+	free(shared);
+}
+
+/**
+ * run_index - Inserts every key in the sharded index one by one or as a
+ *	batch, searches every key, or iterates over the whole index in order
+ *	(variants 0 to 3).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_index(void *state, const int *keys, size_t n, int variant)
+{
+	sharded_index_t *index = ((bench_shared_t *)state)->index;
+	sharded_iter_t iter;
+	size_t i, count = 0;
+	int value;
+
+	for (i = 0; i < n && variant == 0; i++)
+		bench_sink(sharded_index_insert(index, keys[i]));
+	if (variant == 1)
+		bench_sink(sharded_index_insert_batch(index, (int *)keys, n));
+	for (i = 0; i < n && variant == 2; i++)
+		bench_sink(sharded_index_search(index, keys[i]));
+	if (variant == 3 && sharded_iter_init(&iter, index))
+	{
+		while (sharded_iter_next(&iter, &value))
+			count++;
+		sharded_iter_end(&iter);
+	}
+
+	return (variant == 3 ? count : n);
+}
+
+/**
+ * run_mq - Inserts every key in the MultiQueue (variant 4), or extracts
+ *	as many values (variant 5).
+ *
+ * @state: Pointer to the state.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_mq(void *state, const int *keys, size_t n, int variant)
+{
+	multiqueue_t *mq = ((bench_shared_t *)state)->mq;
+	unsigned int seed = 2;
+	size_t i;
+	int value;
+
+	for (i = 0; i < n; i++)
+	{
+		if (variant == 4)
+			bench_sink(multiqueue_insert(mq, keys[i], &seed));
+		else
+			bench_sink(multiqueue_extract(mq, &value, &seed));
+	}
+
+	return (n);
+}
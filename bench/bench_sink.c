@@ -0,0 +1,14 @@
+#include "bench.h"
+
+volatile int bench_sunk;
+
+/**
+ * bench_sink - Consumes a result so the compiler cannot drop the call
+ *	that produced it.
+ *
+ * @value: Result to consume.
+*/
+void bench_sink(int value)
+{
+	bench_sunk += value;
+}
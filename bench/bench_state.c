@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+int bench_compare(const void *a, const void *b);
+
+/**
+ * bench_setup_empty - Creates the state of a benchmark building its own
+ *	tree.
+ *
+ * @keys: Unused.
+ * @n: Unused.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *bench_setup_empty(const int *keys, size_t n, int variant)
+{
+	(void)keys;
+	(void)n;
+	(void)variant;
+
+	return (calloc(1, sizeof(bench_tree_t)));
+}
+
+/**
+ * bench_setup_bst - Creates the state of a benchmark working on the BST
+ *	built by inserting the keys in order.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *bench_setup_bst(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *state = bench_setup_empty(keys, n, variant);
+
+	if (!state)
+		return (NULL);
+	state->nodes = malloc(sizeof(*state->nodes) * n);
+	if (!state->nodes)
+	{
+		free(state);
+		return (NULL);
+	}
+	state->root = bench_build_bst(keys, n, state->nodes, &state->count);
+
+	return (state);
+}
+
+/**
+ * bench_setup_sorted - Creates the state of a benchmark working on the
+ *	distinct keys in increasing order.
+ *
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Unused.
+ *
+ * Return: Pointer to the state, or NULL on failure.
+*/
+void *bench_setup_sorted(const int *keys, size_t n, int variant)
+{
+	bench_tree_t *state = bench_setup_empty(keys, n, variant);
+	int *array;
+	size_t i;
+
+	if (!state)
+		return (NULL);
+	array = malloc(sizeof(*array) * (n + 1));
+	if (!array)
+	{
+		free(state);
+		return (NULL);
+	}
+	memcpy(array, keys, sizeof(*keys) * n);
+	qsort(array, n, sizeof(*keys), &bench_compare);
+	for (i = 0; i < n; i++)
+		if (!state->size || array[state->size - 1] != array[i])
+			array[state->size++] = array[i];
+	state->array = array;
+
+	return (state);
+}
+
+/**
+ * bench_teardown_tree - Releases the state of a tree benchmark.
+ *
+ * @state: Pointer to the state.
+*/
+void bench_teardown_tree(void *state)
+{
+	bench_tree_t *tree = state;
+
+	if (tree)
+	{
+		bench_free_tree(tree->root);
+		free(tree->nodes);
+		free(tree->array);
+		free(tree);
+	}
+}
+
+/**
+ * bench_compare - Compares two keys for qsort.
+ *
+ * @a: Pointer to the first key.
+ * @b: Pointer to the second key.
+ *
+ * Return: Negative, 0 or positive as a is lower, equal or greater than b.
+*/
+int bench_compare(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return ((x > y) - (x < y));
+}
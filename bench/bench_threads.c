@@ -0,0 +1,79 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include "bench.h"
+
+void *bench_thread(void *arg);
+
+/**
+ * bench_threads - Runs a workload split between threads.
+ *
+ * Description: The keys are split in contiguous slices, one for each
+ *	thread, which works on its own slice with its index as id. The
+ *	calling thread runs the first slice, and every thread waits for the
+ *	others to be created before starting, so the time measured around
+ *	the call is that of the slowest thread plus creating and joining
+ *	them. A thread that cannot be created makes the measurement fail.
+ *
+ * @state: Pointer to the state shared by the threads.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Argument passed to work.
+ * @threads: Number of threads, at least 1.
+ * @work: Pointer to the function run by each thread on its slice,
+ *	returning its number of operations.
+ *
+ * Return: Number of operations of all the threads.
+*/
+size_t bench_threads(void *state, const int *keys, size_t n, int variant,
+	size_t threads, size_t (*work)(void *state, const int *keys, size_t n,
+	int variant, int tid))
+{
+	bench_thread_t *slots = calloc(threads, sizeof(*slots));
+	pthread_barrier_t barrier;
+	size_t i, ops = 0;
+
+	if (!slots || pthread_barrier_init(&barrier, NULL, threads))
+		exit(2);
+	for (i = 0; i < threads; i++)
+	{
+		slots[i].barrier = &barrier;
+		slots[i].work = work;
+		slots[i].state = state;
+		slots[i].keys = keys + n * i / threads;
+		slots[i].n = n * (i + 1) / threads - n * i / threads;
+		slots[i].variant = variant;
+		slots[i].tid = (int)i;
+		if (i && pthread_create(&slots[i].thread, NULL, &bench_thread,
+			slots + i))
+			exit(2);
+	}
+	bench_thread(slots);
+	for (i = 0; i < threads; i++)
+	{
+		if (i)
+			pthread_join(slots[i].thread, NULL);
+		ops += slots[i].ops;
+	}
+	pthread_barrier_destroy(&barrier);
+	free(slots);
+
+	return (ops);
+}
+
+/**
+ * bench_thread - Runs the share of a workload of one thread.
+ *
+ * @arg: Pointer to the bench_thread_t of the thread.
+ *
+ * Return: NULL.
+*/
+void *bench_thread(void *arg)
+{
+	bench_thread_t *slot = arg;
+
+	pthread_barrier_wait(slot->barrier);
+	slot->ops = slot->work(slot->state, slot->keys, slot->n,
+		slot->variant, slot->tid);
+
+	return (NULL);
+}
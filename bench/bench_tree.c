@@ -0,0 +1,219 @@
+#include "bench.h"
+
+size_t run_build(void *state, const int *keys, size_t n, int variant);
+size_t run_walk(void *state, const int *keys, size_t n, int variant);
+size_t run_query(void *state, const int *keys, size_t n, int variant);
+size_t run_node(void *state, const int *keys, size_t n, int variant);
+size_t run_parallel(void *state, const int *keys, size_t n, int variant);
+size_t run_export(void *state, const int *keys, size_t n, int variant);
+
+/**
+ * main - Benchmarks the generic binary tree functions.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 on success, 1 on usage error.
+*/
+int main(int argc, char **argv)
+{
+	static const bench_t benches[] = {
+		{"binary_tree_insert_left", &bench_setup_empty, &run_build,
+			&bench_teardown_tree, 0},
+		{"binary_tree_insert_right", &bench_setup_empty, &run_build,
+			&bench_teardown_tree, 1},
+		{"binary_tree_preorder", &bench_setup_bst, &run_walk,
+			&bench_teardown_tree, 0},
+		{"binary_tree_inorder", &bench_setup_bst, &run_walk,
+			&bench_teardown_tree, 1},
+		{"binary_tree_postorder", &bench_setup_bst, &run_walk,
+			&bench_teardown_tree, 2},
+		{"binary_tree_delete", &bench_setup_bst, &run_walk,
+			&bench_teardown_tree, 3},
+		{"binary_tree_height", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 0},
+		{"binary_tree_size", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 1},
+		{"binary_tree_leaves", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 2},
+		{"binary_tree_nodes", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 3},
+		{"binary_tree_is_full", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 4},
+		{"binary_tree_is_perfect", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 5},
+		{"binary_tree_stats", &bench_setup_bst, &run_query,
+			&bench_teardown_tree, 6},
+		{"binary_tree_parallel_counts", &bench_setup_bst, &run_parallel,
+			&bench_teardown_tree, 0},
+		{"binary_tree_parallel_values", &bench_setup_bst, &run_parallel,
+			&bench_teardown_tree, 1},
+		{"binary_tree_parallel_histogram", &bench_setup_bst,
+			&run_parallel, &bench_teardown_tree, 2},
+		{"binary_tree_fprint", &bench_setup_bst, &run_export,
+			&bench_teardown_tree, 0},
+		{"binary_tree_to_dot", &bench_setup_bst, &run_export,
+			&bench_teardown_tree, 1},
+		{"binary_tree_to_json", &bench_setup_bst, &run_export,
+			&bench_teardown_tree, 2},
+		{"binary_tree_depth", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 0},
+		{"binary_tree_is_leaf", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 1},
+		{"binary_tree_is_root", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 2},
+		{"binary_tree_sibling", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 3},
+		{"binary_tree_uncle", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 4},
+		{"binary_tree_rotate_left", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 5},
+		{"binary_tree_rotate_right", &bench_setup_bst, &run_node,
+			&bench_teardown_tree, 6}
+	};
+
+	return (bench_main(argc, argv, "tree", benches,
+		sizeof(benches) / sizeof(*benches)));
+}
+
+/**
+ * run_build - Builds a tree with binary_tree_insert_left (variant 0) or
+ *	binary_tree_insert_right (variant 1) under the root.
+ *
+ * @state: Pointer to the state, starting with an empty tree.
+ * @keys: Array of keys.
+ * @n: Number of keys.
+ * @variant: Operation to time.
+ *
+ * Return: Number of operations.
+*/
+size_t run_build(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	size_t i;
+
+	tree->root = binary_tree_node(NULL, 0);
+	for (i = 0; i < n; i++)
+	{
+		if (variant)
+			binary_tree_insert_right(tree->root, keys[i]);
+		else
+			binary_tree_insert_left(tree->root, keys[i]);
+	}
+
+	return (n);
+}
+
+/**
+ * run_walk - Walks the whole tree once in pre-order, in-order or
+ *	post-order, or deletes it (variants 0 to 3).
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Unused.
+ * @variant: Operation to time.
+ *
+ * Return: Number of nodes walked.
+*/
+size_t run_walk(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+
+	(void)keys;
+	(void)n;
+	if (variant == 0)
+		binary_tree_preorder(tree->root, &bench_sink);
+	else if (variant == 1)
+		binary_tree_inorder(tree->root, &bench_sink);
+	else if (variant == 2)
+		binary_tree_postorder(tree->root, &bench_sink);
+	else
+	{
+		binary_tree_delete(tree->root);
+		tree->root = NULL;
+	}
+
+	return (tree->count);
+}
+
+/**
+ * run_query - Calls a function of the whole tree repeatedly, timing one
+ *	call per operation (variants 0 to 6).
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Number of keys, the more the fewer calls.
+ * @variant: Function to time.
+ *
+ * Return: Number of calls.
+*/
+size_t run_query(void *state, const int *keys, size_t n, int variant)
+{
+	const binary_tree_t *root = ((bench_tree_t *)state)->root;
+	size_t calls = 1 + 1000000 / n, i;
+	tree_stats_t stats;
+
+	(void)keys;
+	for (i = 0; i < calls; i++)
+	{
+		if (variant == 0)
+			bench_sink(binary_tree_height(root));
+		else if (variant == 1)
+			bench_sink(binary_tree_size(root));
+		else if (variant == 2)
+			bench_sink(binary_tree_leaves(root));
+		else if (variant == 3)
+			bench_sink(binary_tree_nodes(root));
+		else if (variant == 4)
+			bench_sink(binary_tree_is_full(root));
+		else if (variant == 5)
+			bench_sink(binary_tree_is_perfect(root));
+		else if (variant == 6 && binary_tree_stats(root, &stats))
+			binary_tree_stats_free(&stats);
+	}
+
+	return (calls);
+}
+
+/**
+ * run_node - Calls a function of a single node on every node (variants 0
+ *	to 6).
+ *
+ * @state: Pointer to the state.
+ * @keys: Unused.
+ * @n: Unused.
+ * @variant: Function to time.
+ *
+ * Return: Number of calls.
+*/
+size_t run_node(void *state, const int *keys, size_t n, int variant)
+{
+	bench_tree_t *tree = state;
+	binary_tree_t *node;
+	size_t i;
+
+	(void)keys;
+	(void)n;
+	for (i = 0; i < tree->count; i++)
+	{
+		node = tree->nodes[i];
+		if (variant == 0)
+			bench_sink(binary_tree_depth(node));
+		else if (variant == 1)
+			bench_sink(binary_tree_is_leaf(node));
+		else if (variant == 2)
+			bench_sink(binary_tree_is_root(node));
+		else if (variant == 3)
+			bench_sink(!!binary_tree_sibling(node));
+		else if (variant == 4)
+			bench_sink(!!binary_tree_uncle(node));
+		else if (variant == 5)
+			node = binary_tree_rotate_left(node);
+		else
+			node = binary_tree_rotate_right(node);
+		if (!node->parent)
+			tree->root = node;
+	}
+
+	return (tree->count);
+}
@@ -0,0 +1,79 @@
+#!/bin/sh
+# Builds the benchmark drivers into bench/bin.
+#
+# Several task files define helpers with the same names, so each driver
+# links only the files it benchmarks.
+# Usage: bench/build.sh [extra compiler flags], from the repository root.
+# The drivers go to $BIN, bench/bin by default.
+
+CC=${CC:-gcc}
+BIN=${BIN:-bench/bin}
+CFLAGS="-O2 -Wall -Wextra -pedantic -std=gnu89 -I. -Ibench $*"
+LDFLAGS="-pthread -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc"
+COMMON="bench/bench.c bench/bench_keys.c bench/bench_state.c
+	bench/bench_alloc.c bench/bench_sink.c bench/bench_counters.c
+	bench/bench_threads.c 0-binary_tree_node.c 190-bt_instrument.c"
+
+build()
+{
+	name=$1
+	shift
+	echo "$CC -o $BIN/$name"
+	$CC $CFLAGS -o "$BIN/$name" $COMMON "$@" $LDFLAGS || exit 1
+}
+
+mkdir -p "$BIN"
+build tree bench/bench_tree.c 1-binary_tree_insert_left.c \
+	2-binary_tree_insert_right.c 3-binary_tree_delete.c \
+	4-binary_tree_is_leaf.c 5-binary_tree_is_root.c \
+	6-binary_tree_preorder.c 7-binary_tree_inorder.c \
+	8-binary_tree_postorder.c 9-binary_tree_height.c \
+	10-binary_tree_depth.c 11-binary_tree_size.c 12-binary_tree_leaves.c \
+	13-binary_tree_nodes.c 15-binary_tree_is_full.c \
+	16-binary_tree_is_perfect.c 17-binary_tree_sibling.c \
+	18-binary_tree_uncle.c 103-binary_tree_rotate_left.c \
+	104-binary_tree_rotate_right.c 170-binary_tree_parallel_reduce.c \
+	171-binary_tree_parallel_counts.c 172-binary_tree_parallel_values.c \
+	173-binary_tree_parallel_histogram.c 180-binary_tree_stats.c \
+	200-bt_writer.c 201-binary_tree_export.c 202-binary_tree_to_dot.c \
+	203-binary_tree_to_json.c binary_tree_print.c bench/bench_parallel.c \
+	bench/bench_export.c
+build bst bench/bench_bst.c 100-binary_trees_ancestor.c \
+	110-binary_tree_is_bst.c 111-bst_insert.c 112-array_to_bst.c \
+	113-bst_search.c 114-bst_remove.c 116-bst_insert_batch.c \
+	117-bst_rebuild.c 118-bst_search_hint.c 119-sgt_insert.c \
+	240-bst_cursor.c 241-bst_cursor_seek.c 3-binary_tree_delete.c \
+	bench/bench_sgt.c
+build avl bench/bench_avl.c 14-binary_tree_balance.c \
+	103-binary_tree_rotate_left.c 104-binary_tree_rotate_right.c \
+	113-bst_search.c 120-binary_tree_is_avl.c 121-avl_insert.c \
+	122-array_to_avl.c 124-sorted_array_to_avl.c 126-avl_insert_batch.c \
+	127-avl_insert_hint.c 116-bst_insert_batch.c 117-bst_rebuild.c \
+	118-bst_search_hint.c 3-binary_tree_delete.c
+build heap bench/bench_heap.c 11-binary_tree_size.c \
+	130-binary_tree_is_heap.c 131-heap_insert.c 132-array_to_heap.c \
+	133-heap_extract.c 136-heap_extract_many.c 137-heap_topk.c \
+	138-heap_sort.c 139-heap_merge.c
+build ptree bench/bench_ptree.c 140-ptree_node.c 141-ptree_insert.c \
+	142-ptree_remove.c 143-pavl_node.c
+build concurrent bench/bench_concurrent.c bench/bench_mixed.c 150-cbst.c \
+	151-cbst_remove.c 152-lfbst.c 153-lfbst_insert.c 154-lfbst_remove.c \
+	155-lfbst_epoch.c
+build sharded bench/bench_sharded.c bench/bench_index.c bench/bench_mq.c \
+	bench/bench_rank.c 3-binary_tree_delete.c 14-binary_tree_balance.c \
+	124-sorted_array_to_avl.c 103-binary_tree_rotate_left.c \
+	104-binary_tree_rotate_right.c \
+	121-avl_insert.c 160-sharded_index.c 161-sharded_index_batch.c \
+	162-sharded_iter.c 163-multiqueue.c 164-multiqueue_extract.c
+build levelorder bench/bench_levelorder.c 101-binary_tree_levelorder.c
+build complete bench/bench_complete.c 102-binary_tree_is_complete.c
+build kv bench/bench_kv.c
+build cmp bench/bench_cmp.c 111-bst_insert.c 113-bst_search.c
+build mset bench/bench_mset.c 210-mset_node.c 211-mset_insert.c \
+	212-mset_remove.c 213-mset_rank.c
+build itree bench/bench_itree.c 220-itree_node.c 221-itree_insert.c \
+	222-itree_overlap.c 223-sorted_array_to_itree.c
+build atree bench/bench_atree.c 230-atree_node.c 231-atree_insert.c \
+	232-atree_range.c
+echo "$CC -o $BIN/scaling"
+$CC $CFLAGS -o "$BIN/scaling" bench/scaling.c bench/scaling_read.c -lm || exit 1
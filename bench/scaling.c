@@ -0,0 +1,172 @@
+#define _POSIX_C_SOURCE 200809L
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench.h"
+
+#define SCALING_MAX_CLAIMS 32
+
+int scaling_claim(scaling_claim_t *claim, char *arg);
+double scaling_cost(const scaling_claim_t *claim, double n);
+void scaling_read(scaling_claim_t *claims, size_t count, const char *line);
+int scaling_check(const scaling_claim_t *claim, double slack);
+
+/**
+ * main - Checks the output of the drivers against complexity claims.
+ *
+ * Description: Usage is "scaling [-s slack] op=class...", the results
+ *	of the drivers being read on the standard input. Only the
+ *	measurements over random keys are used, the claims being average
+ *	cases.
+ *
+ * @argc: Number of arguments.
+ * @argv: Array of arguments.
+ *
+ * Return: 0 if every operation grows within its claim, 1 otherwise.
+*/
+int main(int argc, char **argv)
+{
+	static scaling_claim_t claims[SCALING_MAX_CLAIMS];
+	double slack = 0.05;
+	char line[1024];
+	size_t count, i;
+	int opt, failed = 0;
+
+	while ((opt = getopt(argc, argv, "s:")) != -1)
+	{
+		if (opt != 's')
+			return (1);
+		slack = strtod(optarg, NULL);
+	}
+	count = argc - optind;
+	if (!count || count > SCALING_MAX_CLAIMS)
+	{
+		fprintf(stderr, "Usage: %s [-s slack] op=class...\n", argv[0]);
+		return (1);
+	}
+	for (i = 0; i < count; i++)
+	{
+		if (scaling_claim(&claims[i], argv[optind + i]))
+		{
+			fprintf(stderr, "%s: bad claim\n", argv[optind + i]);
+			return (1);
+		}
+	}
+
+	while (fgets(line, sizeof(line), stdin))
+		scaling_read(claims, count, line);
+	for (i = 0; i < count; i++)
+		failed |= scaling_check(&claims[i], slack);
+
+	return (failed);
+}
+
+/**
+ * scaling_claim - Parses a claim of the form "op=class" or "op=class/n",
+ *	the latter for a class covering all n keys at once.
+ *
+ * @claim: Pointer to the claim to fill.
+ * @arg: Argument holding the claim, modified in place.
+ *
+ * Return: 0 on success, 1 if the claim is malformed.
+*/
+int scaling_claim(scaling_claim_t *claim, char *arg)
+{
+	char *class = strchr(arg, '='), *per_key;
+
+	if (!class)
+		return (1);
+	*class++ = '\0';
+	per_key = strstr(class, "/n");
+	if (per_key && !per_key[2])
+		*per_key = '\0';
+	claim->op = arg;
+	claim->class = class;
+	claim->per_key = per_key && !per_key[0];
+
+	return (!*arg || scaling_cost(claim, 2) <= 0);
+}
+
+/**
+ * scaling_cost - Computes the cost of one operation allowed by a claim.
+ *
+ * @claim: Pointer to the claim.
+ * @n: Size of the input.
+ *
+ * Return: Cost up to a constant factor, or 0 if the class is unknown.
+*/
+double scaling_cost(const scaling_claim_t *claim, double n)
+{
+	double cost = 0;
+
+	if (!strcmp(claim->class, "O(1)"))
+		cost = 1;
+	else if (!strcmp(claim->class, "O(log(n))"))
+		cost = log(n);
+	else if (!strcmp(claim->class, "O(log^2(n))"))
+		cost = log(n) * log(n);
+	else if (!strcmp(claim->class, "O(n)"))
+		cost = n;
+	else if (!strcmp(claim->class, "O(nlog(n))"))
+		cost = n * log(n);
+	else if (!strcmp(claim->class, "O(n^2)"))
+		cost = n * n;
+
+	return (claim->per_key ? cost / n : cost);
+}
+
+/**
+ * scaling_check - Fits the growth of an operation beyond its claim and
+ *	prints the verdict.
+ *
+ * Description: The slope of log(measure / cost) against log(n) is fitted
+ *	by least squares, so an operation within its claim stays near 0 and
+ *	one a factor of n slower than claimed reaches 1. Counted work only
+ *	drifts by the lower order terms of the claim, up to 0.03 for the
+ *	operations checked, while a log factor too many reaches about 0.08
+ *	between 1000 and 1000000 keys. Caches make the time of even a
+ *	correct operation drift by up to 0.35, so timed operations need a
+ *	larger slack and only catch polynomial slowdowns.
+ *
+ * @claim: Pointer to the claim.
+ * @slack: Largest slope accepted.
+ *
+ * Return: 0 if the operation grows within its claim, 1 otherwise.
+*/
+int scaling_check(const scaling_claim_t *claim, double slack)
+{
+	double x, y, mx = 0, my = 0, sxy = 0, sxx = 0, slope = 0;
+	size_t i;
+	int failed;
+
+	for (i = 0; i < claim->count; i++)
+	{
+		mx += log(claim->n[i]) / claim->count;
+		my += log(claim->ns[i] / scaling_cost(claim, claim->n[i])) /
+			claim->count;
+	}
+	for (i = 0; i < claim->count; i++)
+	{
+		x = log(claim->n[i]) - mx;
+		y = log(claim->ns[i] / scaling_cost(claim, claim->n[i])) - my;
+		sxy += x * y;
+		sxx += x * x;
+	}
+	if (sxx > 0)
+		slope = sxy / sxx;
+	failed = claim->count < 2 || claim->failed || slope > slack;
+
+	printf("%-4s %-20s %-12s n^%+.2f beyond claim, %s",
+		failed ? "FAIL" : "ok", claim->op, claim->class, slope,
+		claim->counted ? "counted" : "timed");
+	if (claim->count)
+		printf(", sizes %.0f..%.0f", claim->n[0],
+			claim->n[claim->count - 1]);
+	if (claim->failed)
+		printf(", failed at %.0f", claim->failed);
+	printf("\n");
+
+	return (failed);
+}
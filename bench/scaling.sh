@@ -0,0 +1,61 @@
+#!/bin/sh
+# Checks the complexities claimed by the *-O files against measurements.
+#
+# Each line of 115-O, 125-O and 135-O is paired with the benchmark of the
+# operation it answers for, run over random keys at sizes growing tenfold,
+# and bench/bin/counted/scaling fits how fast each one grows beyond its
+# claim. The drivers are built with -DBT_INSTRUMENT into bench/bin/counted
+# first, so the comparisons and hops of each operation are checked rather
+# than its time, which caches blur. There is no avl_remove to check the
+# second line of 125-O against. The third line of 135-O is checked against
+# heap_sort, whose work is reported per key. Only the first word of a line,
+# the average bound, is checked.
+# Exits with 1 if an operation grows faster than claimed, or fails.
+# Usage: bench/scaling.sh [-n max_size] [-t timeout] [-b budget]
+# [-s slack], from the repository root.
+
+MAX=1000000
+TIMEOUT=30
+BUDGET=5
+SLACK=0.05
+BIN=bench/bin/counted
+while getopts n:t:b:s: opt
+do
+	case $opt in
+	n) MAX=$OPTARG ;;
+	t) TIMEOUT=$OPTARG ;;
+	b) BUDGET=$OPTARG ;;
+	s) SLACK=$OPTARG ;;
+	*) exit 1 ;;
+	esac
+done
+
+claim()
+{
+	sed -n "$2p" "$1" | cut -d ' ' -f 1
+}
+
+run()
+{
+	"$BIN/$1" -n "$MAX" -t "$TIMEOUT" -b "$BUDGET" -d random "$2"
+}
+
+BIN=$BIN sh bench/build.sh -DBT_INSTRUMENT > /dev/null 2>&1 || {
+	echo "bench/build.sh -DBT_INSTRUMENT failed" >&2
+	exit 1
+}
+
+{
+	run bst bst_insert
+	run bst bst_remove
+	run bst bst_search
+	run avl avl_insert
+	run avl avl_search
+	run heap heap_insert
+	run heap heap_extract
+	run heap heap_sort
+} | "$BIN/scaling" -s "$SLACK" \
+	bst_insert="$(claim 115-O 1)" bst_remove="$(claim 115-O 2)" \
+	bst_search="$(claim 115-O 3)" avl_insert="$(claim 125-O 1)" \
+	avl_search="$(claim 125-O 3)" heap_insert="$(claim 135-O 1)" \
+	heap_extract="$(claim 135-O 2)" heap_sort="$(claim 135-O 3)/n"
@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+double scaling_counted(const char *line);
+
+/**
+ * scaling_read - Records a result of the drivers if it is over random
+ *	keys and its operation is claimed.
+ *
+ * @claims: Array of claims.
+ * @count: Number of claims.
+ * @line: Line of output of a driver.
+*/
+void scaling_read(scaling_claim_t *claims, size_t count, const char *line)
+{
+	const char *op = strstr(line, "\"op\":\""), *field;
+	scaling_claim_t *claim;
+	double n;
+	size_t i;
+
+	if (!op || !strstr(line, "\"dist\":\"random\"") ||
+		!(field = strstr(line, "\"n\":")))
+		return;
+	op += 6;
+	n = strtod(field + 4, NULL);
+	for (i = 0; i < count; i++)
+	{
+		claim = &claims[i];
+		if (strncmp(op, claim->op, strlen(claim->op)) ||
+			op[strlen(claim->op)] != '"')
+			continue;
+		field = strstr(line, "\"ns_per_op\":");
+		if (strstr(line, "\"error\":") || !field)
+		{
+			if (!claim->failed || n < claim->failed)
+				claim->failed = n;
+		}
+		else if (claim->count < SCALING_MAX_SIZES && n > 1)
+		{
+			claim->n[claim->count] = n;
+			claim->ns[claim->count] = scaling_counted(line);
+			claim->counted = claim->ns[claim->count] > 0;
+			if (!claim->counted)
+				claim->ns[claim->count] = strtod(field + 12,
+					NULL);
+			claim->count++;
+		}
+	}
+}
+
+/**
+ * scaling_counted - Reads the instrumentation counters of a result of the
+ *	drivers.
+ *
+ * Description: Comparisons and pointers followed count the work of an
+ *	operation exactly, whatever the caches do, so they are checked
+ *	instead of the time when the drivers are built with -DBT_INSTRUMENT
+ *	and the operation is instrumented.
+ *
+ * @line: Line of output of a driver.
+ *
+ * Return: Number of comparisons and hops per operation, or 0 if there
+ *	are none.
+*/
+double scaling_counted(const char *line)
+{
+	const char *comparisons = strstr(line, "\"comparisons_per_op\":");
+	const char *hops = strstr(line, "\"hops_per_op\":");
+
+	if (!comparisons || !hops)
+		return (0);
+
+	return (strtod(comparisons + 21, NULL) + strtod(hops + 14, NULL));
+}
@@ -3,97 +3,208 @@
 #include <string.h>
 #include "binary_trees.h"
 
-/* Original code from http://stackoverflow.com/a/13755911/5184480 */
+/* Layout from http://stackoverflow.com/a/13755911/5184480 */
 
 /**
- * print_t - Stores recursively each level in an array of strings
+ * struct print_row_s - State of the rendering of one row of a tree
  *
- * @tree: Pointer to the node to print
- * @offset: Offset to print
- * @depth: Depth of the node
- * @s: Buffer
+ * @levels: Number of levels rendered, the deeper nodes being left out
+ * @rows: Number of rows of the rendering, found while walking the tree
+ * @row: Index of the row rendered
+ * @line: Buffer of the row, or NULL to only measure the tree
+ * @offset: Column where the next node in order starts
+ * @end: Column after the last node of the row
+ * @mark: Column of the pending link to a left child, or -1
+ * @mark_width: Width of the left child linked by mark
+ */
+typedef struct print_row_s
+{
+	size_t levels;
+	size_t rows;
+	size_t row;
+	char *line;
+	size_t offset;
+	size_t end;
+	size_t mark;
+	size_t mark_width;
+} print_row_t;
+
+/**
+ * print_box - Formats the value of a node as "(%03d)"
  *
- * Return: length of printed tree after process
+ * @buf: Buffer of at least 16 bytes, or NULL to only measure the box
+ * @n: Value to format
+ *
+ * Return: Number of characters of the box
  */
-static int print_t(const binary_tree_t *tree, int offset, int depth, char **s)
+static size_t print_box(char *buf, int n)
 {
-	char b[6];
-	int width, left, right, is_left, i;
+	char digits[12];
+	unsigned int u = n < 0 ? -(unsigned int)n : (unsigned int)n;
+	size_t len = 0, width = 0;
 
-	if (!tree)
-		return (0);
-	is_left = (tree->parent && tree->parent->left == tree);
-	width = sprintf(b, "(%03d)", tree->n);
-	left = print_t(tree->left, offset, depth + 1, s);
-	right = print_t(tree->right, offset + left + width, depth + 1, s);
-	for (i = 0; i < width; i++)
-		s[depth][offset + left + i] = b[i];
-	if (depth && is_left)
+	if (!buf)
+	{
+		for (len = 1; u >= 10; len++)
+			u /= 10;
+		return ((len < 3 ? 3 : len + (n < 0)) + 2);
+	}
+	do {
+		digits[len++] = '0' + u % 10;
+		u /= 10;
+	} while (u);
+	while (len < (n < 0 ? 2u : 3u))
+		digits[len++] = '0';
+	buf[width++] = '(';
+	if (n < 0)
+		buf[width++] = '-';
+	while (len)
+		buf[width++] = digits[--len];
+	buf[width++] = ')';
+	return (width);
+}
+
+/**
+ * print_visit - Lays out a node, drawing it if it is on the row rendered
+ *	and its link if it is one level below
+ *
+ * Description: A node is drawn over the links of its children, so the
+ *	link to a right child starts after its parent.
+ *
+ * @node: Pointer to the node, visited in order
+ * @depth: Depth of the node below the root of the rendering
+ * @state: Pointer to the state of the row
+ */
+static void print_visit(const binary_tree_t *node, size_t depth,
+	print_row_t *state)
+{
+	char box[16], *line = state->line;
+	size_t width, start = state->offset;
+
+	if (!line || (depth != state->row && depth != state->row + 1))
+	{
+		state->offset += print_box(NULL, node->n);
+		return;
+	}
+	width = print_box(box, node->n);
+	state->offset += width;
+	if (depth == state->row + 1 && node->parent->left == node)
 	{
-		for (i = 0; i < width + right; i++)
-			s[depth - 1][offset + left + width / 2 + i] = '-';
-		s[depth - 1][offset + left + width / 2] = '.';
+		state->mark = start + width / 2;
+		state->mark_width = width;
 	}
-	else if (depth && !is_left)
+	else if (depth == state->row + 1)
 	{
-		for (i = 0; i < left + width; i++)
-			s[depth - 1][offset - width / 2 + i] = '-';
-		s[depth - 1][offset + left + width / 2] = '.';
+		memset(line + state->end, '-', start + width - width / 2 -
+			state->end);
+		line[start + width / 2] = '.';
+	}
+	else if (depth == state->row)
+	{
+		if (state->mark != (size_t)-1)
+		{
+			memset(line + state->mark, '-', start +
+				state->mark_width / 2 - state->mark);
+			line[state->mark] = '.';
+			state->mark = -1;
+		}
+		memcpy(line + start, box, width);
+		state->end = start + width;
 	}
-	return (left + width + right);
 }
 
 /**
- * _height - Measures the height of a binary tree
+ * print_walk - Walks a tree in order down to the levels rendered
+ *
+ * Description: The walk follows the parent pointers, so it needs no
+ *	stack however deep the tree is.
  *
- * @tree: Pointer to the node to measures the height
+ * @tree: Pointer to the root node of the rendering
+ * @state: Pointer to the state of the row
  *
- * Return: The height of the tree starting at @node
+ * Return: Width of the rendering
  */
-static size_t _height(const binary_tree_t *tree)
+static size_t print_walk(const binary_tree_t *tree, print_row_t *state)
 {
-	size_t height_l;
-	size_t height_r;
+	const binary_tree_t *node = tree;
+	size_t depth = 0;
+	int down = 1;
 
-	height_l = tree->left ? 1 + _height(tree->left) : 0;
-	height_r = tree->right ? 1 + _height(tree->right) : 0;
-	return (height_l > height_r ? height_l : height_r);
+	state->offset = state->end = 0;
+	state->mark = -1;
+	while (node)
+	{
+		if (down && depth >= state->rows)
+			state->rows = depth + 1;
+		if (down && node->left && depth + 1 < state->levels)
+		{
+			node = node->left, depth++;
+			continue;
+		}
+		print_visit(node, depth, state);
+		down = node->right && depth + 1 < state->levels;
+		if (down)
+		{
+			node = node->right, depth++;
+			continue;
+		}
+		while (node != tree && node == node->parent->right)
+			node = node->parent, depth--;
+		node = node == tree ? NULL : node->parent;
+		depth--;
+	}
+	return (state->offset);
 }
 
 /**
- * binary_tree_print - Prints a binary tree
+ * binary_tree_fprint - Prints a binary tree to a stream
  *
- * @tree: Pointer to the root node of the tree to print
+ * Description: The tree is measured first, then each row is rendered in
+ *	one buffer as wide as the tree and written out, so the memory used
+ *	is linear in the width of the rendering. Each row walks the levels
+ *	printed, so limiting them keeps large trees quick to look at.
+ *
+ * @stream: Stream to print to
+ * @tree: Pointer to the root node of the tree, or subtree, to print
+ * @levels: Number of levels to print, or 0 to print them all
+ *
+ * Return: 0 on success, or -1 on failure
  */
-void binary_tree_print(const binary_tree_t *tree)
+int binary_tree_fprint(FILE *stream, const binary_tree_t *tree,
+	size_t levels)
 {
-	char **s;
-	size_t height, i, j;
+	print_row_t state;
+	size_t width, len;
+	int status = 0;
 
 	if (!tree)
-		return;
-	height = _height(tree);
-	s = malloc(sizeof(*s) * (height + 1));
-	if (!s)
-		return;
-	for (i = 0; i < height + 1; i++)
-	{
-		s[i] = malloc(sizeof(**s) * 255);
-		if (!s[i])
-			return;
-		memset(s[i], 32, 255);
-	}
-	print_t(tree, 0, 0, s);
-	for (i = 0; i < height + 1; i++)
+		return (0);
+	memset(&state, 0, sizeof(state));
+	state.levels = levels ? levels : (size_t)-1;
+	width = print_walk(tree, &state);
+	state.line = malloc(width + 1);
+	if (!state.line)
+		return (-1);
+	for (state.row = 0; state.row < state.rows && !status; state.row++)
 	{
-		for (j = 254; j > 1; --j)
-		{
-			if (s[i][j] != ' ')
-				break;
-			s[i][j] = '\0';
-		}
-		printf("%s\n", s[i]);
-		free(s[i]);
+		memset(state.line, ' ', width);
+		print_walk(tree, &state);
+		for (len = width; len > 2 && state.line[len - 1] == ' '; len--)
+			;
+		state.line[len++] = '\n';
+		if (fwrite(state.line, 1, len, stream) != len)
+			status = -1;
 	}
-	free(s);
+	free(state.line);
+	return (status);
+}
+
+/**
+ * binary_tree_print - Prints a binary tree
+ *
+ * @tree: Pointer to the root node of the tree to print
+ */
+void binary_tree_print(const binary_tree_t *tree)
+{
+	binary_tree_fprint(stdout, tree, 0);
 }
@@ -2,6 +2,20 @@
 #define _BINARY_TREES_H
 
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#define LFBST_MAX_THREADS 64
+#define LFBST_FLAG 1
+#define LFBST_TAG 2
+#define LFBST_ADDR(field) ((lfbst_node_t *)((field) & ~(uintptr_t)3))
+#define BT_WRITER_SIZE (1 << 20)
+#define BT_EXPORT_HEIGHT 1
+#define BT_EXPORT_BALANCE 2
+#define BT_EXPORT_SIZE 4
+#define BT_CACHE_LINE 64
+#define PTREE_PATH_MAX 64
 
 /**
  * struct binary_tree_s - Binary tree node
@@ -24,6 +38,609 @@ typedef struct binary_tree_s bst_t;  /*Binary search tree*/
 typedef struct binary_tree_s avl_t;  /*AVL tree*/
 typedef struct binary_tree_s heap_t;  /*Max binary heap*/
 
+/**
+ * struct heap_topk_s - Bounded Min Binary Heap keeping the k largest values
+ *	of a stream
+ *
+ * @data: Array holding the heap, smallest kept value first
+ * @size: Number of values currently kept
+ * @k: Maximum number of values kept
+ */
+typedef struct heap_topk_s
+{
+	int *data;
+	size_t size;
+	size_t k;
+} heap_topk_t;
+
+/**
+ * struct persistent_tree_s - Reference-counted node shared between versions
+ *	of a persistent BST or AVL tree
+ *
+ * @n: Integer stored in the node
+ * @height: Height of the subtree rooted at the node, 1 for a leaf
+ * @refs: Number of parent nodes and version roots referencing the node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct persistent_tree_s
+{
+	int n;
+	int height;
+	size_t refs;
+	struct persistent_tree_s *left;
+	struct persistent_tree_s *right;
+} ptree_t;
+
+/**
+ * struct cbst_node_s - Node of a thread-safe BST
+ *
+ * @n: Integer stored in the node
+ * @lock: Lock held while the node or its child pointers are used
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct cbst_node_s
+{
+	int n;
+	pthread_mutex_t lock;
+	struct cbst_node_s *left;
+	struct cbst_node_s *right;
+} cbst_node_t;
+
+/**
+ * struct cbst_s - Thread-safe BST using hand-over-hand locking
+ *
+ * @root: Pointer to the root node
+ * @lock: Lock guarding the root pointer, taken first by every operation
+ */
+typedef struct cbst_s
+{
+	cbst_node_t *root;
+	pthread_mutex_t lock;
+} cbst_t;
+
+/**
+ * struct lfbst_node_s - Node of a lock-free external BST
+ *
+ * @n: Integer stored in the node
+ * @inf: 0 for a regular value, or the rank of a sentinel value greater
+ *	than every integer
+ * @left: Pointer to the left child node, with the LFBST_FLAG and LFBST_TAG
+ *	marks in its low bits, 0 in a leaf
+ * @right: Pointer to the right child node, marked like left
+ * @retired: Next node in the list of nodes waiting to be freed
+ */
+typedef struct lfbst_node_s
+{
+	int n;
+	int inf;
+	uintptr_t left;
+	uintptr_t right;
+	struct lfbst_node_s *retired;
+} lfbst_node_t;
+
+/**
+ * struct lfbst_epoch_s - Epoch reclamation state of a thread
+ *
+ * @epoch: Last global epoch observed by the thread
+ * @active: 1 while the thread is inside an operation, 0 otherwise
+ * @limbo: Nodes retired by the thread, by epoch of retirement modulo 3
+ * @count: Number of nodes retired by the thread
+ *
+ * Each state starts on its own cache line, so a thread entering and leaving
+ * operations does not invalidate the caches of its neighbours.
+ */
+typedef struct lfbst_epoch_s
+{
+	size_t epoch;
+	int active;
+	lfbst_node_t *limbo[3];
+	size_t count;
+} __attribute__((aligned(BT_CACHE_LINE))) lfbst_epoch_t;
+
+/**
+ * struct lfbst_s - Lock-free external BST
+ *
+ * @root: Pointer to the sentinel root node
+ * @epoch: Global epoch
+ * @threads: Epoch state of each thread, indexed by thread id
+ *
+ * The global epoch has a cache line of its own, away from the root read by
+ * every search and from the states of the threads.
+ */
+typedef struct lfbst_s
+{
+	lfbst_node_t *root;
+	size_t epoch __attribute__((aligned(BT_CACHE_LINE)));
+	lfbst_epoch_t threads[LFBST_MAX_THREADS];
+} lfbst_t;
+
+/**
+ * struct lfbst_seek_s - Nodes met on the path to a value
+ *
+ * @ancestor: Last node reached through an untagged edge above successor
+ * @successor: Child of ancestor on the path
+ * @parent: Parent of leaf
+ * @leaf: Leaf where the path ends
+ */
+typedef struct lfbst_seek_s
+{
+	lfbst_node_t *ancestor;
+	lfbst_node_t *successor;
+	lfbst_node_t *parent;
+	lfbst_node_t *leaf;
+} lfbst_seek_t;
+
+/**
+ * struct shard_s - One AVL tree of a sharded index
+ *
+ * @root: Pointer to the root node of the AVL tree
+ * @lock: Lock held while the tree is used
+ */
+typedef struct shard_s
+{
+	avl_t *root;
+	pthread_mutex_t lock;
+} shard_t;
+
+/**
+ * struct sharded_index_s - Set of integers spread by hash over AVL trees
+ *
+ * @shards: Array of shards
+ * @count: Number of shards
+ */
+typedef struct sharded_index_s
+{
+	shard_t *shards;
+	size_t count;
+} sharded_index_t;
+
+/**
+ * struct sharded_iter_s - In-order iterator over a copy of every shard of
+ *	an index
+ *
+ * @values: Values of every shard, shard after shard, each shard in order
+ * @next: Index in values of the next value of each shard
+ * @ends: Index in values after the last value of each shard
+ * @heap: Min heap of the shards with values left, by their next value
+ * @count: Number of shards in heap
+ */
+typedef struct sharded_iter_s
+{
+	int *values;
+	size_t *next;
+	size_t *ends;
+	size_t *heap;
+	size_t count;
+} sharded_iter_t;
+
+/**
+ * struct mq_heap_s - Array Max Binary Heap of a multiqueue
+ *
+ * @data: Array holding the heap
+ * @size: Number of values in the heap
+ * @capacity: Number of values the array can hold
+ * @top: Copy of data[0], readable without the lock when size is not 0
+ * @lock: Lock held while the heap is used
+ *
+ * Each heap starts on its own cache line, so threads using neighbouring
+ * heaps do not invalidate each other's caches.
+ */
+typedef struct mq_heap_s
+{
+	int *data;
+	size_t size;
+	size_t capacity;
+	int top;
+	pthread_mutex_t lock;
+} __attribute__((aligned(BT_CACHE_LINE))) mq_heap_t;
+
+/**
+ * struct multiqueue_s - Relaxed concurrent Max priority queue
+ *
+ * @heaps: Array of heaps
+ * @count: Number of heaps
+ */
+typedef struct multiqueue_s
+{
+	mq_heap_t *heaps;
+	size_t count;
+} multiqueue_t;
+
+/**
+ * struct tree_reducer_s - Reduction folded over every node of a tree
+ *
+ * @size: Size in bytes of an accumulator
+ * @init: Pointer to a function setting an accumulator to the identity
+ * @visit: Pointer to a function folding a node, found at a given depth,
+ *	into an accumulator
+ * @merge: Pointer to a function folding a second accumulator into the first
+ * @arg: Argument passed to every function
+ */
+typedef struct tree_reducer_s
+{
+	size_t size;
+	void (*init)(void *acc, void *arg);
+	void (*visit)(void *acc, const binary_tree_t *node, size_t depth,
+		void *arg);
+	void (*merge)(void *acc, const void *other, void *arg);
+	void *arg;
+} tree_reducer_t;
+
+/**
+ * struct reduce_task_s - Subtree reduced by one task of a parallel reduction
+ *
+ * @node: Pointer to the root node of the subtree
+ * @depth: Depth of node in the whole tree
+ */
+typedef struct reduce_task_s
+{
+	const binary_tree_t *node;
+	size_t depth;
+} reduce_task_t;
+
+/**
+ * struct reduce_job_s - State shared by the workers of a parallel reduction
+ *
+ * @reducer: Pointer to the reduction
+ * @tasks: Array of tasks
+ * @count: Number of tasks
+ * @next: Index of the next task to take
+ * @workers: Number of workers that took an accumulator
+ * @accs: Array of accumulators, one per worker, aligned on a cache line
+ * @failed: 1 if a worker ran out of memory, 0 otherwise
+ * @stride: Size in bytes of an accumulator, rounded up to whole cache lines
+ */
+typedef struct reduce_job_s
+{
+	const tree_reducer_t *reducer;
+	reduce_task_t *tasks;
+	size_t count;
+	size_t next;
+	size_t workers;
+	char *accs;
+	int failed;
+	size_t stride;
+} reduce_job_t;
+
+/**
+ * struct tree_counts_s - Shape counts of a binary tree
+ *
+ * @size: Number of nodes, as binary_tree_size
+ * @leaves: Number of leaves, as binary_tree_leaves
+ * @nodes: Number of nodes with at least 1 child, as binary_tree_nodes
+ * @height: Height, as binary_tree_height
+ */
+typedef struct tree_counts_s
+{
+	size_t size;
+	size_t leaves;
+	size_t nodes;
+	size_t height;
+} tree_counts_t;
+
+/**
+ * struct tree_values_s - Statistics of the values of a binary tree
+ *
+ * @count: Number of values
+ * @sum: Sum of the values
+ * @min: Lowest value, meaningful only if count is not 0
+ * @max: Greatest value, meaningful only if count is not 0
+ */
+typedef struct tree_values_s
+{
+	size_t count;
+	long sum;
+	int min;
+	int max;
+} tree_values_t;
+
+/**
+ * struct tree_histogram_s - Histogram of the values of a binary tree
+ *
+ * @lo: Lowest value of the first bin
+ * @width: Number of values covered by each bin
+ * @count: Number of bins
+ * @bins: Array of count bins, values out of range go to the first or last
+ */
+typedef struct tree_histogram_s
+{
+	int lo;
+	int width;
+	size_t count;
+	size_t *bins;
+} tree_histogram_t;
+
+/**
+ * struct tree_stats_s - Shape statistics of a binary tree
+ *
+ * @height: Height, as binary_tree_height
+ * @size: Number of nodes, as binary_tree_size
+ * @leaves: Number of leaves, as binary_tree_leaves
+ * @nodes: Number of nodes with at least 1 child, as binary_tree_nodes
+ * @balance: Balance factor, as binary_tree_balance
+ * @is_full: 1 if the tree is full, as binary_tree_is_full
+ * @is_perfect: 1 if the tree is perfect, as binary_tree_is_perfect
+ * @depths: Array of the number of nodes at each depth
+ * @leaf_depths: Array of the number of leaves at each depth
+ * @levels: Number of elements in depths and leaf_depths
+ */
+typedef struct tree_stats_s
+{
+	size_t height;
+	size_t size;
+	size_t leaves;
+	size_t nodes;
+	int balance;
+	int is_full;
+	int is_perfect;
+	size_t *depths;
+	size_t *leaf_depths;
+	size_t levels;
+} tree_stats_t;
+
+/**
+ * enum bt_op_e - Operations instrumentation counters are attributed to
+ *
+ * @BT_OP_OTHER: Anything called outside of the operations below
+ * @BT_OP_BST_INSERT: bst_insert
+ * @BT_OP_BST_SEARCH: bst_search
+ * @BT_OP_BST_REMOVE: bst_remove
+ * @BT_OP_AVL_INSERT: avl_insert
+ * @BT_OP_HEAP_INSERT: heap_insert
+ * @BT_OP_HEAP_EXTRACT: heap_extract
+ * @BT_OP_DELETE: binary_tree_delete
+ * @BT_OP_COUNT: Number of operations
+ */
+typedef enum bt_op_e
+{
+	BT_OP_OTHER,
+	BT_OP_BST_INSERT,
+	BT_OP_BST_SEARCH,
+	BT_OP_BST_REMOVE,
+	BT_OP_AVL_INSERT,
+	BT_OP_HEAP_INSERT,
+	BT_OP_HEAP_EXTRACT,
+	BT_OP_DELETE,
+	BT_OP_COUNT
+} bt_op_t;
+
+/**
+ * struct bt_counters_s - Instrumentation counters of one operation
+ *
+ * @comparisons: Number of key comparisons
+ * @hops: Number of pointers followed while descending a tree
+ * @rotations: Number of rotations
+ * @allocs: Number of nodes allocated by binary_tree_node
+ * @frees: Number of nodes freed
+ */
+typedef struct bt_counters_s
+{
+	size_t comparisons;
+	size_t hops;
+	size_t rotations;
+	size_t allocs;
+	size_t frees;
+} bt_counters_t;
+
+/**
+ * struct bt_instrument_s - Instrumentation counters of a thread
+ *
+ * @ops: Counters of each operation, indexed by bt_op_t
+ */
+typedef struct bt_instrument_s
+{
+	bt_counters_t ops[BT_OP_COUNT];
+} bt_instrument_t;
+
+/**
+ * struct bt_writer_s - Buffered writer of an output stream
+ *
+ * @stream: Stream written to
+ * @len: Number of bytes in buf not yet written
+ * @error: 1 once a write to stream failed
+ * @buf: Buffer of the output
+ */
+typedef struct bt_writer_s
+{
+	FILE *stream;
+	size_t len;
+	int error;
+	char buf[BT_WRITER_SIZE];
+} bt_writer_t;
+
+/**
+ * struct tree_metrics_s - Annotations of a node in an export
+ *
+ * @height: Height of the subtree of the node, as binary_tree_height
+ * @balance: Balance factor of the node, as binary_tree_balance
+ * @size: Number of nodes in the subtree of the node
+ */
+typedef struct tree_metrics_s
+{
+	size_t height;
+	int balance;
+	size_t size;
+} tree_metrics_t;
+
+/**
+ * struct tree_exporter_s - Format of an export of a binary tree
+ *
+ * @head: Text written before the tree
+ * @tail: Text written after the tree
+ * @empty: Text written for an empty tree
+ * @enter: Pointer to a function writing a node before its left subtree,
+ *	or NULL
+ * @middle: Pointer to a function writing a node between its subtrees,
+ *	or NULL
+ * @leave: Pointer to a function writing a node after its right subtree,
+ *	or NULL. It gets the annotations of the node, or NULL if none is
+ *	asked for, and the BT_EXPORT_* flags asked for
+ */
+typedef struct tree_exporter_s
+{
+	const char *head;
+	const char *tail;
+	const char *empty;
+	void (*enter)(bt_writer_t *writer, const binary_tree_t *node);
+	void (*middle)(bt_writer_t *writer, const binary_tree_t *node);
+	void (*leave)(bt_writer_t *writer, const binary_tree_t *node,
+		const tree_metrics_t *metrics, int flags);
+} tree_exporter_t;
+
+/**
+ * struct tree_export_s - State of an export of a binary tree
+ *
+ * @writer: Pointer to the writer of the output
+ * @exporter: Pointer to the format of the output
+ * @flags: BT_EXPORT_* flags of the annotations asked for
+ * @metrics: Stack of the annotations of the subtrees left but not yet
+ *	joined to their parent
+ * @top: Number of annotations on the stack
+ * @capacity: Number of annotations the stack can hold
+ */
+typedef struct tree_export_s
+{
+	bt_writer_t *writer;
+	const tree_exporter_t *exporter;
+	int flags;
+	tree_metrics_t *metrics;
+	size_t top;
+	size_t capacity;
+} tree_export_t;
+
+/**
+ * struct mset_node_s - Node of a counted multiset, an AVL tree keeping the
+ *	number of occurrences of each value
+ *
+ * @n: Integer stored in the node
+ * @height: Height of the subtree rooted at the node, 1 for a leaf
+ * @count: Number of occurrences of n, at least 1
+ * @total: Sum of the counts of the subtree rooted at the node, so the
+ *	total of the root is the size of the multiset
+ * @parent: Pointer to the parent node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct mset_node_s
+{
+	int n;
+	int height;
+	size_t count;
+	size_t total;
+	struct mset_node_s *parent;
+	struct mset_node_s *left;
+	struct mset_node_s *right;
+} mset_t;
+
+/**
+ * struct interval_s - Closed interval of integers
+ *
+ * @lo: Start of the interval
+ * @hi: End of the interval, not lower than lo
+ */
+typedef struct interval_s
+{
+	int lo;
+	int hi;
+} interval_t;
+
+/**
+ * struct itree_node_s - Node of an interval tree, an AVL tree of intervals
+ *	ordered by start, then by end
+ *
+ * @lo: Start of the interval
+ * @hi: End of the interval, not lower than lo
+ * @max: Greatest end of the intervals in the subtree rooted at the node
+ * @height: Height of the subtree rooted at the node, 1 for a leaf
+ * @parent: Pointer to the parent node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct itree_node_s
+{
+	int lo;
+	int hi;
+	int max;
+	int height;
+	struct itree_node_s *parent;
+	struct itree_node_s *left;
+	struct itree_node_s *right;
+} itree_t;
+
+/**
+ * struct atree_node_s - Node of an aggregate tree, an AVL tree of keys
+ *	holding values, each node keeping statistics of the values of its
+ *	subtree
+ *
+ * @n: Key stored in the node
+ * @value: Value of the key
+ * @height: Height of the subtree rooted at the node, 1 for a leaf
+ * @values: Count, sum, min and max of the values of the subtree rooted
+ *	at the node
+ * @parent: Pointer to the parent node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct atree_node_s
+{
+	int n;
+	int value;
+	int height;
+	tree_values_t values;
+	struct atree_node_s *parent;
+	struct atree_node_s *left;
+	struct atree_node_s *right;
+} atree_t;
+
+/**
+ * struct bst_cursor_s - Position in the in-order walk of a BST
+ *
+ * @root: Pointer to the root node of the BST
+ * @node: Pointer to the node the cursor is on, or NULL past either end
+ */
+typedef struct bst_cursor_s
+{
+	const bst_t *root;
+	const bst_t *node;
+} bst_cursor_t;
+
+/**
+ * struct sgt_s - BST kept balanced as a scapegoat tree
+ *
+ * @root: Pointer to the root node of the BST
+ * @size: Number of nodes in the tree
+ * @max_size: Greatest number of nodes since the whole tree was last
+ *	rebuilt
+ */
+typedef struct sgt_s
+{
+	bst_t *root;
+	size_t size;
+	size_t max_size;
+} sgt_t;
+
+/*
+ * Instrumentation is compiled in with -DBT_INSTRUMENT, otherwise every
+ * macro below expands to nothing but its argument.
+ */
+#ifdef BT_INSTRUMENT
+extern __thread bt_instrument_t bt_instrument;
+extern __thread bt_op_t bt_op_current;
+#define BT_COUNT(field) ((void)bt_instrument.ops[bt_op_current].field++)
+#define BT_CMP(expr) (BT_COUNT(comparisons), (expr))
+#define BT_HOP(ptr) (BT_COUNT(hops), (ptr))
+#define BT_OP_ENTER(op) bt_op_enter(op)
+#define BT_OP_EXIT() bt_op_exit()
+#else
+#define BT_COUNT(field) ((void)0)
+#define BT_CMP(expr) (expr)
+#define BT_HOP(ptr) (ptr)
+#define BT_OP_ENTER(op) ((void)0)
+#define BT_OP_EXIT() ((void)0)
+#endif
+
 /**
  * enum nodes - Children of the binary tree.
  *
@@ -37,6 +654,8 @@ typedef enum nodes
 {DEFAULT, NONE, LEFT, RIGHT, BOTH} CHILD_NODES;
 
 void binary_tree_print(const binary_tree_t *tree);
+int binary_tree_fprint(FILE *stream, const binary_tree_t *tree,
+	size_t levels);
 
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
 binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value);
@@ -54,6 +673,7 @@ size_t binary_tree_leaves(const binary_tree_t *tree);
 size_t binary_tree_nodes(const binary_tree_t *tree);
 int binary_tree_is_full(const binary_tree_t *tree);
 int binary_tree_is_perfect(const binary_tree_t *tree);
+int binary_tree_is_perfect_size(size_t height, size_t size);
 binary_tree_t *binary_tree_sibling(binary_tree_t *node);
 binary_tree_t *binary_tree_uncle(binary_tree_t *node);
 int binary_tree_balance(const binary_tree_t *tree);
@@ -69,15 +689,138 @@ bst_t *bst_insert(bst_t **tree, int value);
 bst_t *array_to_bst(int *array, size_t size);
 bst_t *bst_search(const bst_t *tree, int value);
 bst_t *bst_remove(bst_t *root, int value);
+bst_t *bst_remove_sorted(bst_t *root, const int *values, size_t size);
+size_t bst_insert_batch(bst_t **tree, const int *values, size_t size);
+bst_t *bst_rebuild(bst_t *tree, size_t size);
+bst_t *bst_search_hint(const bst_t *hint, int value);
+bst_t *bst_hint_slot(const bst_t *hint, int value);
+bst_t *sgt_insert(sgt_t *tree, int value);
+int sgt_remove(sgt_t *tree, int value);
 
 int binary_tree_is_avl(const binary_tree_t *tree);
 avl_t *avl_insert(avl_t **tree, int value);
 avl_t *array_to_avl(int *array, size_t size);
 avl_t *sorted_array_to_avl(int *array, size_t size);
+size_t avl_insert_batch(avl_t **tree, const int *values, size_t size);
+avl_t *avl_insert_hint(avl_t **tree, avl_t *hint, int value);
 
 int binary_tree_is_heap(const binary_tree_t *tree);
 heap_t *heap_insert(heap_t **root, int value);
 heap_t *array_to_heap(int *array, size_t size);
 int heap_extract(heap_t **root);
+size_t heap_extract_many(heap_t **root, size_t k, int *out);
+heap_topk_t *heap_topk_create(size_t k);
+int heap_topk_push(heap_topk_t *acc, int value);
+size_t heap_topk_drain(heap_topk_t *acc, int *out);
+void heap_topk_delete(heap_topk_t *acc);
+void heap_sort(int *array, size_t size);
+size_t heap_merge(int **runs, size_t *sizes, size_t k, int *out);
+
+ptree_t *ptree_node(ptree_t *left, int value, ptree_t *right);
+ptree_t *ptree_retain(ptree_t *tree);
+void ptree_release(ptree_t *tree);
+ptree_t *ptree_search(const ptree_t *tree, int value);
+int ptree_height(const ptree_t *tree);
+ptree_t *pavl_node(ptree_t *left, int value, ptree_t *right);
+ptree_t *pbst_insert(ptree_t *root, int value);
+ptree_t *pavl_insert(ptree_t *root, int value);
+ptree_t *pbst_remove(ptree_t *root, int value);
+ptree_t *pavl_remove(ptree_t *root, int value);
+
+cbst_t *cbst_create(void);
+void cbst_delete(cbst_t *tree);
+int cbst_search(cbst_t *tree, int value);
+int cbst_insert(cbst_t *tree, int value);
+int cbst_remove(cbst_t *tree, int value);
+
+lfbst_t *lfbst_create(void);
+void lfbst_delete(lfbst_t *tree);
+int lfbst_search(lfbst_t *tree, int value, int tid);
+int lfbst_insert(lfbst_t *tree, int value, int tid);
+int lfbst_remove(lfbst_t *tree, int value, int tid);
+
+sharded_index_t *sharded_index_create(size_t count);
+void sharded_index_delete(sharded_index_t *index);
+int sharded_index_insert(sharded_index_t *index, int value);
+int sharded_index_search(sharded_index_t *index, int value);
+size_t sharded_index_insert_batch(sharded_index_t *index, int *values,
+	size_t size);
+int sharded_iter_init(sharded_iter_t *iter, sharded_index_t *index);
+int sharded_iter_next(sharded_iter_t *iter, int *value);
+void sharded_iter_end(sharded_iter_t *iter);
+
+multiqueue_t *multiqueue_create(size_t count);
+void multiqueue_delete(multiqueue_t *mq);
+int multiqueue_insert(multiqueue_t *mq, int value, unsigned int *seed);
+int multiqueue_extract(multiqueue_t *mq, int *value, unsigned int *seed);
+
+int binary_tree_parallel_reduce(const binary_tree_t *tree,
+	const tree_reducer_t *reducer, size_t threads, void *result);
+int binary_tree_parallel_counts(const binary_tree_t *tree, size_t threads,
+	tree_counts_t *counts);
+int binary_tree_parallel_values(const binary_tree_t *tree, size_t threads,
+	tree_values_t *values);
+int binary_tree_parallel_histogram(const binary_tree_t *tree, size_t threads,
+	tree_histogram_t *histogram);
+
+int binary_tree_stats(const binary_tree_t *tree, tree_stats_t *stats);
+void binary_tree_stats_free(tree_stats_t *stats);
+
+void bt_op_enter(bt_op_t op);
+void bt_op_exit(void);
+void bt_instrument_snapshot(bt_instrument_t *snapshot);
+void bt_instrument_reset(void);
+
+bt_writer_t *bt_writer_open(FILE *stream);
+void bt_write(bt_writer_t *writer, const char *buf, size_t len);
+void bt_write_long(bt_writer_t *writer, long value);
+void bt_write_hex(bt_writer_t *writer, uintptr_t value);
+int bt_writer_close(bt_writer_t *writer);
+int binary_tree_export(FILE *stream, const binary_tree_t *tree,
+	const tree_exporter_t *exporter, int flags);
+int binary_tree_to_dot(FILE *stream, const binary_tree_t *tree, int flags);
+int binary_tree_to_json(FILE *stream, const binary_tree_t *tree, int flags);
+
+mset_t *mset_node(mset_t *parent, int value);
+mset_t *mset_insert(mset_t **tree, int value);
+int mset_remove(mset_t **tree, int value);
+void mset_delete(mset_t *tree);
+mset_t *mset_search(const mset_t *tree, int value);
+size_t mset_count(const mset_t *tree, int value);
+size_t mset_rank(const mset_t *tree, int value);
+size_t mset_range_count(const mset_t *tree, int lo, int hi);
+mset_t *mset_select(const mset_t *tree, size_t rank);
+
+itree_t *itree_node(itree_t *parent, int lo, int hi);
+itree_t *itree_insert(itree_t **tree, int lo, int hi);
+int itree_remove(itree_t **tree, int lo, int hi);
+void itree_delete(itree_t *tree);
+itree_t *itree_search(const itree_t *tree, int lo, int hi);
+size_t itree_overlap(const itree_t *tree, int lo, int hi,
+	void (*func)(const itree_t *node, void *arg), void *arg);
+size_t itree_stab(const itree_t *tree, int point,
+	void (*func)(const itree_t *node, void *arg), void *arg);
+itree_t *sorted_array_to_itree(const interval_t *array, size_t size);
+
+atree_t *atree_node(atree_t *parent, int key, int value);
+atree_t *atree_insert(atree_t **tree, int key, int value);
+int atree_remove(atree_t **tree, int key);
+void atree_delete(atree_t *tree);
+atree_t *atree_search(const atree_t *tree, int key);
+void atree_merge(tree_values_t *values, const tree_values_t *other);
+size_t atree_range(const atree_t *tree, int lo, int hi,
+	tree_values_t *values);
+
+const bst_t *bst_cursor_first(bst_cursor_t *cursor, const bst_t *tree);
+const bst_t *bst_cursor_last(bst_cursor_t *cursor, const bst_t *tree);
+const bst_t *bst_cursor_next(bst_cursor_t *cursor);
+const bst_t *bst_cursor_prev(bst_cursor_t *cursor);
+int bst_cursor_get(const bst_cursor_t *cursor, int *value);
+const bst_t *bst_cursor_seek(bst_cursor_t *cursor, const bst_t *tree,
+	int value);
+const bst_t *bst_cursor_lower_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value);
+const bst_t *bst_cursor_upper_bound(bst_cursor_t *cursor, const bst_t *tree,
+	int value);
 
 #endif  /*_BINARY_TREES_H*/
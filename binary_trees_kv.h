@@ -0,0 +1,458 @@
+#ifndef _BINARY_TREES_KV_H
+#define _BINARY_TREES_KV_H
+
+#include <stdlib.h>
+
+/*
+ * Key/value trees, generated for a key type and a value type by
+ * BT_KV_DEFINE(prefix, key_type, value_type). Values are stored inline in
+ * the nodes, so a value type can be a pointer to a payload or a
+ * fixed-size struct. Of the int trees declared in binary_trees.h, only
+ * those keeping parent pointers and more than a height in their nodes,
+ * the counted multisets, interval trees and aggregate trees, use this
+ * header, for the rotations of BT_AVL_DEFINE.
+ *
+ * Keys are ordered by BT_KV_COMPARE, that is by <, unless another
+ * comparator is given:
+ *
+ * BT_KV_DEFINE_CMP(prefix, key_type, value_type, cmp) calls cmp(a, b),
+ *	a function or a function-like macro returning a negative number,
+ *	0 or a positive number as a sorts before, with or after b. The
+ *	comparison is inlined wherever the compiler can see it.
+ * BT_KV_DEFINE_DYNAMIC(prefix, key_type, value_type) calls the function
+ *	pointer set by prefix_set_compare(), such as strcmp for strings,
+ *	which must be set before the trees are used.
+ *
+ * A comparator must have no side effects: a search asks it whether the
+ * keys are equal and then which way to go, which an inlined comparison
+ * turns into the two tests an int search makes.
+ *
+ * Every generated function is static, so an instantiation belongs to one
+ * translation unit. The generated names all start with prefix:
+ *
+ * prefix_node_t: Node, holding key, the height of its subtree, kept up
+ *	to date by the AVL functions only, left, right, parent and value.
+ *	What a search reads comes first, so it rarely spans two cache lines
+ * prefix_heap_t: Max heap by key, holding its root and its size
+ * prefix_node(): Creates a node
+ * prefix_search(): Finds the node of a key in a BST or an AVL tree
+ * prefix_update(): Replaces the value of a key in a BST or an AVL tree
+ * prefix_delete(): Deletes a tree
+ * prefix_bst_insert(), prefix_bst_remove(): Inserts or removes a key in a
+ *	BST
+ * prefix_avl_insert(), prefix_avl_remove(): Inserts or removes a key in
+ *	an AVL tree, in O(log(n))
+ * prefix_heap_insert(), prefix_heap_extract(), prefix_heap_replace(),
+ *	prefix_heap_delete(): Operate on a heap, in O(log(n))
+ *
+ * Removing a node with two children and moving an entry in a heap copy
+ * keys and values between nodes, so pointers to nodes are only valid
+ * until the next change of the tree.
+ */
+#define BT_KV_COMPARE(a, b) (((b) < (a)) - ((a) < (b)))
+#define BT_KV_DEFINE(prefix, key_type, value_type) \
+	BT_KV_DEFINE_CMP(prefix, key_type, value_type, BT_KV_COMPARE)
+#define BT_KV_DEFINE_DYNAMIC(prefix, key_type, value_type) \
+	BT_KV_DYNAMIC(prefix, key_type, value_type, prefix##_call) \
+	BT_KV_DEFINE_CMP(prefix, key_type, value_type, prefix##_call)
+#define BT_KV_DEFINE_CMP(prefix, key_type, value_type, cmp) \
+	BT_KV_TYPES(prefix, key_type, value_type, cmp) \
+	BT_KV_TREE(prefix, key_type, value_type, cmp) \
+	BT_KV_BST(prefix, key_type, value_type, cmp) \
+	BT_KV_AVL(prefix, key_type, value_type, cmp) \
+	BT_KV_HEAP(prefix, key_type, value_type, cmp)
+
+/*
+ * BT_LINKED_DEFINE - Defines, for node_type, any struct with parent, left
+ * and right members, prefix_replace(), which puts a node, its only child
+ * or NULL, in the place of another, and prefix_free(), which frees a
+ * tree or a subtree. prefix_free() follows the parent pointers, so it
+ * needs no stack however deep the tree is.
+ */
+#define BT_LINKED_DEFINE(prefix, node_type) \
+static __inline__ void prefix##_replace(node_type **root, node_type *node, \
+	node_type *child) \
+{ \
+	if (child) \
+		child->parent = node->parent; \
+	if (!node->parent) \
+		*root = child; \
+	else if (node->parent->left == node) \
+		node->parent->left = child; \
+	else \
+		node->parent->right = child; \
+} \
+static __inline__ void prefix##_free(node_type *tree) \
+{ \
+	node_type *top = tree, *parent; \
+\
+	while (tree) \
+	{ \
+		if (tree->left || tree->right) \
+		{ \
+			tree = tree->left ? tree->left : tree->right; \
+			continue; \
+		} \
+		parent = tree == top ? NULL : tree->parent; \
+		if (parent && parent->left == tree) \
+			parent->left = NULL; \
+		else if (parent) \
+			parent->right = NULL; \
+		free(tree); \
+		tree = parent; \
+	} \
+}
+
+/*
+ * BT_AVL_DEFINE - Defines the rebalancing of an AVL tree of node_type,
+ * which also has a height member, after BT_LINKED_DEFINE for the same
+ * prefix. fix(node) sets the height of node from its children, and
+ * whatever else the tree keeps of each subtree, such as the number of
+ * values of a multiset: it is the only part that differs from one tree
+ * to another. prefix_rotate() rotates a node left or right, fixing it
+ * and then the node taking its place, which it returns.
+ * prefix_rebalance() walks up from a node to the root, rotating the
+ * unbalanced nodes and fixing the others, so it goes on to the root even
+ * once the heights stop changing.
+ */
+#define BT_AVL_HEIGHT(node) ((node) ? (node)->height : 0)
+#define BT_AVL_DEFINE(prefix, node_type, fix) \
+static __inline__ node_type *prefix##_rotate(node_type **root, \
+	node_type *node, int left) \
+{ \
+	node_type *pivot = left ? node->right : node->left, *inner; \
+\
+	inner = left ? pivot->left : pivot->right; \
+	if (left) \
+	{ \
+		node->right = inner; \
+		pivot->left = node; \
+	} \
+	else \
+	{ \
+		node->left = inner; \
+		pivot->right = node; \
+	} \
+	if (inner) \
+		inner->parent = node; \
+	prefix##_replace(root, node, pivot); \
+	node->parent = pivot; \
+	fix(node); \
+	fix(pivot); \
+	return (pivot); \
+} \
+static __inline__ void prefix##_rebalance(node_type **root, \
+	node_type *node) \
+{ \
+	int balance; \
+\
+	for (; node; node = node->parent) \
+	{ \
+		balance = BT_AVL_HEIGHT(node->left) - \
+			BT_AVL_HEIGHT(node->right); \
+		if (balance > 1 && BT_AVL_HEIGHT(node->left->left) < \
+			BT_AVL_HEIGHT(node->left->right)) \
+			prefix##_rotate(root, node->left, 1); \
+		else if (balance < -1 && BT_AVL_HEIGHT(node->right->right) < \
+			BT_AVL_HEIGHT(node->right->left)) \
+			prefix##_rotate(root, node->right, 0); \
+		if (balance > 1 || balance < -1) \
+			node = prefix##_rotate(root, node, balance < -1); \
+		else \
+			fix(node); \
+	} \
+}
+
+/*
+ * BT_KV_DYNAMIC - Defines the comparator of an instantiation by
+ * BT_KV_DEFINE_DYNAMIC, set by prefix_set_compare(), and prefix_call(),
+ * through which the generated functions call it. prefix_call() is pure,
+ * so a comparison written twice is only made once.
+ */
+#define BT_KV_DYNAMIC(prefix, key_type, value_type, cmp) \
+static int (*prefix##_compare)(key_type a, key_type b); \
+static __inline__ void prefix##_set_compare( \
+	int (*compare)(key_type a, key_type b)) \
+{ \
+	prefix##_compare = compare; \
+} \
+static __inline__ __attribute__((pure)) int prefix##_call(key_type a, \
+	key_type b) \
+{ \
+	return (prefix##_compare(a, b)); \
+}
+
+/*
+ * BT_KV_TYPES - Defines prefix_node_t and prefix_heap_t.
+ */
+#define BT_KV_TYPES(prefix, key_type, value_type, cmp) \
+typedef struct prefix##_node_s \
+{ \
+	key_type key; \
+	int height; \
+	struct prefix##_node_s *left; \
+	struct prefix##_node_s *right; \
+	struct prefix##_node_s *parent; \
+	value_type value; \
+} prefix##_node_t; \
+typedef struct prefix##_heap_s \
+{ \
+	prefix##_node_t *root; \
+	size_t size; \
+} prefix##_heap_t;
+
+/*
+ * BT_KV_TREE - Defines the functions shared by every kind of tree, and
+ * prefix_unlink(), which removes a node from a BST.
+ */
+#define BT_KV_TREE(prefix, key_type, value_type, cmp) \
+BT_LINKED_DEFINE(prefix, prefix##_node_t) \
+static __inline__ prefix##_node_t *prefix##_node(prefix##_node_t *parent, \
+	key_type key, value_type value) \
+{ \
+	prefix##_node_t *node = malloc(sizeof(*node)); \
+\
+	if (!node) \
+		return (NULL); \
+	node->key = key; \
+	node->value = value; \
+	node->parent = parent; \
+	node->left = NULL; \
+	node->right = NULL; \
+	node->height = 1; \
+	return (node); \
+} \
+static __inline__ prefix##_node_t *prefix##_search( \
+	const prefix##_node_t *tree, key_type key) \
+{ \
+	while (tree && cmp(key, tree->key)) \
+		tree = cmp(key, tree->key) < 0 ? tree->left : tree->right; \
+	return ((prefix##_node_t *)tree); \
+} \
+static __inline__ prefix##_node_t *prefix##_update(prefix##_node_t *tree, \
+	key_type key, value_type value) \
+{ \
+	prefix##_node_t *node = prefix##_search(tree, key); \
+\
+	if (node) \
+		node->value = value; \
+	return (node); \
+} \
+static __inline__ void prefix##_delete(prefix##_node_t *tree) \
+{ \
+	prefix##_free(tree); \
+} \
+static __inline__ prefix##_node_t *prefix##_unlink(prefix##_node_t **root, \
+	prefix##_node_t *node) \
+{ \
+	prefix##_node_t *next, *parent; \
+\
+	if (node->left && node->right) \
+	{ \
+		for (next = node->right; next->left; next = next->left) \
+			; \
+		node->key = next->key; \
+		node->value = next->value; \
+		node = next; \
+	} \
+	parent = node->parent; \
+	prefix##_replace(root, node, node->left ? node->left : node->right); \
+	free(node); \
+	return (parent); \
+}
+
+/*
+ * BT_KV_BST - Defines prefix_bst_insert(), which returns the new node, or
+ * NULL if the key is already in the tree or on failure, and
+ * prefix_bst_remove(), which stores the value of the key removed in
+ * value if it is not NULL, and returns 1, or 0 if the key is not in the
+ * tree.
+ */
+#define BT_KV_BST(prefix, key_type, value_type, cmp) \
+static __inline__ prefix##_node_t *prefix##_bst_insert( \
+	prefix##_node_t **root, key_type key, value_type value) \
+{ \
+	prefix##_node_t **link = root, *parent = NULL; \
+	int diff; \
+\
+	while (*link) \
+	{ \
+		parent = *link; \
+		diff = cmp(key, parent->key); \
+		if (diff < 0) \
+			link = &parent->left; \
+		else if (diff > 0) \
+			link = &parent->right; \
+		else \
+			return (NULL); \
+	} \
+	*link = prefix##_node(parent, key, value); \
+	return (*link); \
+} \
+static __inline__ int prefix##_bst_remove(prefix##_node_t **root, \
+	key_type key, value_type *value) \
+{ \
+	prefix##_node_t *node = prefix##_search(*root, key); \
+\
+	if (!node) \
+		return (0); \
+	if (value) \
+		*value = node->value; \
+	prefix##_unlink(root, node); \
+	return (1); \
+}
+
+/*
+ * BT_KV_AVL - Defines prefix_avl_insert() and prefix_avl_remove(), which
+ * behave as their BST counterparts and then rebalance the tree from the
+ * parent of the node inserted or removed up to the root, using the
+ * heights kept in the nodes.
+ */
+#define BT_KV_AVL(prefix, key_type, value_type, cmp) \
+static __inline__ void prefix##_fix(prefix##_node_t *node) \
+{ \
+	int left = BT_AVL_HEIGHT(node->left); \
+	int right = BT_AVL_HEIGHT(node->right); \
+\
+	node->height = (left > right ? left : right) + 1; \
+} \
+BT_AVL_DEFINE(prefix, prefix##_node_t, prefix##_fix) \
+static __inline__ prefix##_node_t *prefix##_avl_insert( \
+	prefix##_node_t **root, key_type key, value_type value) \
+{ \
+	prefix##_node_t *node = prefix##_bst_insert(root, key, value); \
+\
+	if (node) \
+		prefix##_rebalance(root, node->parent); \
+	return (node); \
+} \
+static __inline__ int prefix##_avl_remove(prefix##_node_t **root, \
+	key_type key, value_type *value) \
+{ \
+	prefix##_node_t *node = prefix##_search(*root, key); \
+\
+	if (!node) \
+		return (0); \
+	if (value) \
+		*value = node->value; \
+	prefix##_rebalance(root, prefix##_unlink(root, node)); \
+	return (1); \
+}
+
+/*
+ * BT_KV_HEAP - Defines the functions of a Max Binary Heap by key. The
+ * node at position i, counting from 1 in level order, is found by
+ * following the bits of i, so no operation walks more than one path.
+ * prefix_heap_insert() returns the node holding the new entry, or NULL
+ * on failure. prefix_heap_extract() stores the key and value of the root
+ * in key and value if they are not NULL, and returns 1, or 0 if the heap
+ * is empty. prefix_heap_replace() replaces the root by a new entry, and
+ * returns 0 if the heap is empty.
+ */
+#define BT_KV_HEAP(prefix, key_type, value_type, cmp) \
+static __inline__ prefix##_node_t *prefix##_heap_at(prefix##_heap_t *heap, \
+	size_t index) \
+{ \
+	prefix##_node_t *node = heap->root; \
+	size_t mask = 1; \
+\
+	while (mask <= index / 2) \
+		mask <<= 1; \
+	for (mask >>= 1; mask; mask >>= 1) \
+		node = index & mask ? node->right : node->left; \
+	return (node); \
+} \
+static __inline__ void prefix##_swap(prefix##_node_t *a, prefix##_node_t *b) \
+{ \
+	key_type key = a->key; \
+	value_type value = a->value; \
+\
+	a->key = b->key; \
+	a->value = b->value; \
+	b->key = key; \
+	b->value = value; \
+} \
+static __inline__ void prefix##_sift_down(prefix##_node_t *node) \
+{ \
+	prefix##_node_t *child; \
+\
+	while (node->left) \
+	{ \
+		child = node->left; \
+		if (node->right && cmp(child->key, node->right->key) < 0) \
+			child = node->right; \
+		if (cmp(node->key, child->key) >= 0) \
+			break; \
+		prefix##_swap(node, child); \
+		node = child; \
+	} \
+} \
+static __inline__ prefix##_node_t *prefix##_heap_insert( \
+	prefix##_heap_t *heap, key_type key, value_type value) \
+{ \
+	prefix##_node_t *parent, *node; \
+\
+	parent = heap->root ? prefix##_heap_at(heap, (heap->size + 1) / 2) \
+		: NULL; \
+	node = prefix##_node(parent, key, value); \
+	if (!node) \
+		return (NULL); \
+	if (!parent) \
+		heap->root = node; \
+	else if (heap->size % 2) \
+		parent->left = node; \
+	else \
+		parent->right = node; \
+	heap->size++; \
+	while (node->parent && cmp(node->parent->key, node->key) < 0) \
+	{ \
+		prefix##_swap(node, node->parent); \
+		node = node->parent; \
+	} \
+	return (node); \
+} \
+static __inline__ int prefix##_heap_extract(prefix##_heap_t *heap, \
+	key_type *key, value_type *value) \
+{ \
+	prefix##_node_t *last; \
+\
+	if (!heap->root) \
+		return (0); \
+	if (key) \
+		*key = heap->root->key; \
+	if (value) \
+		*value = heap->root->value; \
+	last = prefix##_heap_at(heap, heap->size--); \
+	if (last == heap->root) \
+		heap->root = NULL; \
+	else if (last->parent->left == last) \
+		last->parent->left = NULL; \
+	else \
+		last->parent->right = NULL; \
+	if (heap->root) \
+	{ \
+		heap->root->key = last->key; \
+		heap->root->value = last->value; \
+		prefix##_sift_down(heap->root); \
+	} \
+	free(last); \
+	return (1); \
+} \
+static __inline__ int prefix##_heap_replace(prefix##_heap_t *heap, \
+	key_type key, value_type value) \
+{ \
+	if (!heap->root) \
+		return (0); \
+	heap->root->key = key; \
+	heap->root->value = value; \
+	prefix##_sift_down(heap->root); \
+	return (1); \
+} \
+static __inline__ void prefix##_heap_delete(prefix##_heap_t *heap) \
+{ \
+	prefix##_delete(heap->root); \
+	heap->root = NULL; \
+	heap->size = 0; \
+}
+
+#endif  /*_BINARY_TREES_KV_H*/